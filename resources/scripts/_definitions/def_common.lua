@@ -13,12 +13,44 @@
 --- @field goToScreen fun(screenId: integer)
 --- @field canClassLearn fun(classType: ClassType, skillType: SkillType)
 
+--- @class SoundCacheStats
+--- @field hits integer
+--- @field misses integer
+--- @field evictions integer
+--- @field sounds integer
+--- @field bytes integer
+--- @field peakBytes integer
+--- @field budget integer
+
+--- @class VoiceStats
+--- @field voices integer
+--- @field virtualVoices integer
+--- @field peakVoices integer
+--- @field started integer
+--- @field stolen integer
+--- @field promoted integer
+--- @field demoted integer
+--- @field dropped integer
+--- @field capacity integer
+
 --- @class AudioBindings
 --- @field playSound fun(soundId: integer, soundPlaybackMode: integer)
 --- @field playMusic fun(musicId: integer)
+--- @field soundCacheStats fun(): SoundCacheStats
+--- @field voiceStats fun(): VoiceStats
+
+--- @class AssetCacheStats
+--- @field hits integer
+--- @field misses integer
+--- @field evictions integer
+--- @field assets integer
+--- @field bytes integer
+--- @field peakBytes integer
+--- @field budget integer
 
 --- @class RendererBindings
 --- @field reloadShaders fun()
+--- @field assetCacheStats fun(): AssetCacheStats
 
 --- @class LogBindings
 --- @field info fun(message:string)
@@ -15,6 +15,7 @@ local ClassCommand = require "dev.commands.class_command"
 local DebugCommand = require "dev.commands.debug_command"
 
 local Renderer = require "bindings.renderer"
+local Audio = require "bindings.audio"
 
 local reloadShadersCommand = {
     name = "reload_shaders",
@@ -25,6 +26,38 @@ local reloadShadersCommand = {
     end
 }
 
+local assetCacheCommand = {
+    name = "asset_cache",
+    description = "Show asset cache statistics",
+    callback = function ()
+        local stats = Renderer.assetCacheStats()
+        local kib = function (bytes) return math.floor(bytes / 1024) end
+        local budget = stats.budget == 0 and "unlimited" or (kib(stats.budget) .. " KiB")
+        return "Assets: " .. stats.assets .. "\n" ..
+            "Memory: " .. kib(stats.bytes) .. " KiB (peak " .. kib(stats.peakBytes) .. " KiB, budget " .. budget .. ")\n" ..
+            "Hits: " .. stats.hits .. ", misses: " .. stats.misses .. ", evictions: " .. stats.evictions, true
+    end
+}
+
+local soundCacheCommand = {
+    name = "sound_cache",
+    description = "Show decoded sound cache & voice statistics",
+    callback = function ()
+        local stats = Audio.soundCacheStats()
+        local voices = Audio.voiceStats()
+        local kib = function (bytes) return math.floor(bytes / 1024) end
+        local budget = stats.budget == 0 and "unlimited" or (kib(stats.budget) .. " KiB")
+        return "Sounds: " .. stats.sounds .. "\n" ..
+            "Memory: " .. kib(stats.bytes) .. " KiB (peak " .. kib(stats.peakBytes) .. " KiB, budget " .. budget ..
+            ")\n" ..
+            "Hits: " .. stats.hits .. ", misses: " .. stats.misses .. ", evictions: " .. stats.evictions .. "\n" ..
+            "Voices: " .. voices.voices .. "/" .. voices.capacity .. ", virtual: " .. voices.virtualVoices ..
+            " (last frame: peak " .. voices.peakVoices .. ", started " .. voices.started .. ", stolen " ..
+            voices.stolen .. ", promoted " .. voices.promoted .. ", demoted " .. voices.demoted .. ", dropped " ..
+            voices.dropped .. ")", true
+    end
+}
+
 -- todo(Gerark) work in progress, need to expose in c++ the functionalities to reload the scripts
 --local reloadScriptsCommand = {
 --    name = "reload_scripts",
@@ -48,6 +81,8 @@ GameCommands.registerGameCommands = function ()
     CommandManager.register(InventoryCommand)
     CommandManager.register(ClearConsoleCommand)
     CommandManager.register(reloadShadersCommand)
+    CommandManager.register(assetCacheCommand)
+    CommandManager.register(soundCacheCommand)
     CommandManager.register(ConditionCommand)
     CommandManager.register(HpCommand)
     CommandManager.register(ManaCommand)
@@ -1688,6 +1688,10 @@ void Game::gameLoop() {
         do {
             MessageLoopWithWait();
 
+            // Picks up the autosave once it's assembled on a worker thread. This is done here and not through a
+            // message because the message queue gets cleared in lots of places.
+            PollPendingSave();
+
             engine->particle_engine->UpdateParticles();
             engine->decal_builder->bloodsplat_container->uNumBloodsplats = 0;
             if (engine->uNumStationaryLights_in_pStationaryLightsStack != pStationaryLightsStack->uNumLightsActive) {
@@ -1845,6 +1849,7 @@ void Game::gameLoop() {
             }
         } while (!game_finished);
 
+        FinishPendingSave(); // Main menu doesn't poll for it.
         pEventTimer->setPaused(true);
         engine->ResetCursor_Palettes_LODs_Level_Audio_SFT_Windows();
         if (uGameState == GAME_STATE_LOADING_GAME) {
@@ -44,6 +44,15 @@ class GameConfig : public Config {
         explicit Audio(GameConfig *config) : ConfigSection(config, "audio") {}
 
         Bool DisableHRTF = {this, "disable_hrtf", true, "Disable HRTF for headphones."};
+
+        Int SoundCacheBudget = {this, "sound_cache_budget", 64, &ValidateSoundCacheBudget,
+            "Memory budget for decoded sounds in MiB. Least recently used sounds that are not playing are unloaded "
+            "when over budget. Use 0 for unlimited."};
+
+     private:
+        static int ValidateSoundCacheBudget(int budget) {
+            return std::max(budget, 0);
+        }
     };
 
     Audio audio{this};
@@ -103,6 +112,14 @@ class GameConfig : public Config {
         Bool NoActors = {this, "no_actors", false,
             "Disable all actors."};
 
+        Bool ParallelActorQueries = {this, "parallel_actor_queries", true,
+            "Run read-only per-actor queries (floor level, terrain slope) on worker threads before updating actors. "
+            "Results are identical to the serial update, this option only exists to simplify profiling."};
+
+        Bool TextTableCache = {this, "text_table_cache", false,
+            "Cache the parsed text tables (items, NPCs, houses, quests, etc) in 'generated/text_tables.bin' and load "
+            "them from there on subsequent launches. The cache is rebuilt automatically when game data changes."};
+
         Bool NoDamage = {this, "no_damage", false,
             "Disable all incoming damage to party."};
 
@@ -472,6 +489,10 @@ class GameConfig : public Config {
         Bool GenerateTiles = {this, "generate_tiles", true,
             "Auto-generate missing tiles on startup and use them where appropriate. MM7 missed some tile transitions, this option fixes this issue."};
 
+        Int TextureCacheBudget = {this, "texture_cache_budget", 0, &ValidateTextureCacheBudget,
+            "Memory budget for loaded textures and sprites in MiB, CPU and GPU memory combined. Least recently used assets "
+            "are unloaded when over budget. Use 0 for unlimited."};
+
      private:
         static int ValidateGamma(int level) {
             return std::clamp(level, 0, 9);
@@ -500,6 +521,9 @@ class GameConfig : public Config {
         static int ValidateRenderFilter(int filter) {
             return std::clamp(filter, 0, 2);
         }
+        static int ValidateTextureCacheBudget(int budget) {
+            return std::max(budget, 0);
+        }
     };
 
     Graphics graphics{this};
@@ -15,6 +15,7 @@
 #include "Engine/EngineGlobals.h"
 #include "Engine/EngineIocContainer.h"
 #include "Engine/Resources/EngineFileSystem.h"
+#include "Engine/SaveLoad.h"
 #include "Engine/VR/VRManager.h"
 #include "Engine/Graphics/Renderer/RendererFactory.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
@@ -218,6 +219,8 @@ void GameStarter::initialize() {
 GameStarter::~GameStarter() {
     _application->removeComponent<EngineControlComponent>(); // Join the control thread first.
 
+    FinishPendingSave(); // Don't lose the autosave.
+
     _game.reset();
     _engine.reset();
 
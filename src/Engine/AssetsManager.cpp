@@ -1,10 +1,14 @@
 #include "Engine/AssetsManager.h"
 
+#include <cassert>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "Engine/Graphics/ImageLoader.h"
 #include "Engine/Graphics/Image.h"
+#include "Engine/Resources/AssetCache.h"
 #include "Engine/Resources/LodTextureCache.h"
 #include "Engine/Resources/LodSpriteCache.h"
 
@@ -12,7 +16,9 @@
 
 #include "Library/Logger/Logger.h"
 
+#include "Utility/Concurrency/ThreadPool.h"
 #include "Utility/String/Ascii.h"
+#include "Utility/MapAccess.h"
 
 AssetsManager *assets = new AssetsManager();
 
@@ -71,28 +77,20 @@ bool AssetsManager::releaseImage(std::string_view name) {
 GraphicsImage *AssetsManager::getImage_Paletted(std::string_view name) {
     std::string filename = ascii::toLower(name);
 
-    auto i = images.find(filename);
-    if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Paletted_Img_Loader>(pIcons_LOD, filename));
-        images[filename] = image;
+    if (GraphicsImage *image = findImage(images, filename))
         return image;
-    }
 
-    return i->second;
+    return insertImage(&images, filename, std::make_unique<Paletted_Img_Loader>(pIcons_LOD, filename));
 }
 
 
 GraphicsImage *AssetsManager::getImage_ColorKey(std::string_view name, Color colorkey) {
     std::string filename = ascii::toLower(name);
 
-    auto i = images.find(filename);
-    if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<ColorKey_LOD_Loader>(pIcons_LOD, filename, colorkey));
-        images[filename] = image;
+    if (GraphicsImage *image = findImage(images, filename))
         return image;
-    }
 
-    return i->second;
+    return insertImage(&images, filename, std::make_unique<ColorKey_LOD_Loader>(pIcons_LOD, filename, colorkey));
 }
 
 
@@ -100,71 +98,50 @@ GraphicsImage *AssetsManager::getImage_ColorKey(std::string_view name, Color col
 GraphicsImage *AssetsManager::getImage_Solid(std::string_view name) {
     std::string filename = ascii::toLower(name);
 
-    auto i = images.find(filename);
-    if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Image16bit_LOD_Loader>(pIcons_LOD, filename));
-        images[filename] = image;
+    if (GraphicsImage *image = findImage(images, filename))
         return image;
-    }
 
-    return i->second;
+    return insertImage(&images, filename, std::make_unique<Image16bit_LOD_Loader>(pIcons_LOD, filename));
 }
 
 GraphicsImage *AssetsManager::getImage_Alpha(std::string_view name) {
     std::string filename = ascii::toLower(name);
 
-    auto i = images.find(filename);
-    if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Alpha_LOD_Loader>(pIcons_LOD, filename));
-        images[filename] = image;
+    if (GraphicsImage *image = findImage(images, filename))
         return image;
-    }
 
-    return i->second;
+    return insertImage(&images, filename, std::make_unique<Alpha_LOD_Loader>(pIcons_LOD, filename));
 }
 
 GraphicsImage *AssetsManager::getImage_Buff(std::string_view name) {
     std::string filename = ascii::toLower(name);
 
-    auto i = images.find(filename);
-    if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Buff_LOD_Loader>(pIcons_LOD, filename));
-        images[filename] = image;
+    if (GraphicsImage *image = findImage(images, filename))
         return image;
-    }
 
-    return i->second;
+    return insertImage(&images, filename, std::make_unique<Buff_LOD_Loader>(pIcons_LOD, filename));
 }
 
 GraphicsImage *AssetsManager::getImage_PCXFromIconsLOD(std::string_view name, Color colorkey) {
     std::string filename = ascii::toLower(name);
 
-    auto i = images.find(filename);
-    if (i == images.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<PCX_LOD_Compressed_Loader>(pIcons_LOD, filename, colorkey));
-        images[filename] = image;
+    if (GraphicsImage *image = findImage(images, filename))
         return image;
-    }
 
-    return i->second;
+    return insertImage(&images, filename, std::make_unique<PCX_LOD_Compressed_Loader>(pIcons_LOD, filename, colorkey));
 }
 
 GraphicsImage *AssetsManager::getBitmap(std::string_view name, bool generated) {
     std::string filename = ascii::toLower(name);
 
-    auto i = bitmaps.find(filename);
-    if (i == bitmaps.end()) {
-        GraphicsImage *image = nullptr;
-        if (generated) {
-            image = GraphicsImage::Create(std::make_unique<Bitmaps_GEN_Loader>(filename));
-        } else {
-            image = GraphicsImage::Create(std::make_unique<Bitmaps_LOD_Loader>(pBitmaps_LOD, filename));
-        }
-        bitmaps[filename] = image;
+    if (GraphicsImage *image = findImage(bitmaps, filename))
         return image;
-    }
 
-    return i->second;
+    if (generated) {
+        return insertImage(&bitmaps, filename, std::make_unique<Bitmaps_GEN_Loader>(filename));
+    } else {
+        return insertImage(&bitmaps, filename, std::make_unique<Bitmaps_LOD_Loader>(pBitmaps_LOD, filename));
+    }
 }
 
 bool AssetsManager::releaseBitmap(std::string_view name) {
@@ -183,14 +160,10 @@ bool AssetsManager::releaseBitmap(std::string_view name) {
 GraphicsImage *AssetsManager::getSprite(std::string_view name) {
     std::string filename = ascii::toLower(name);
 
-    auto i = sprites.find(filename);
-    if (i == sprites.end()) {
-        auto image = GraphicsImage::Create(std::make_unique<Sprites_LOD_Loader>(pSprites_LOD, filename));
-        sprites[filename] = image;
+    if (GraphicsImage *image = findImage(sprites, filename))
         return image;
-    }
 
-    return i->second;
+    return insertImage(&sprites, filename, std::make_unique<Sprites_LOD_Loader>(pSprites_LOD, filename));
 }
 
 bool AssetsManager::releaseSprite(std::string_view name) {
@@ -206,3 +179,102 @@ bool AssetsManager::releaseSprite(std::string_view name) {
     return true;
 }
 
+
+GraphicsImage *AssetsManager::findImage(const std::unordered_map<std::string, GraphicsImage *> &map,
+                                        const std::string &name) {
+    GraphicsImage *result = valueOr(map, name, nullptr);
+    if (result)
+        assetCache->recordHit();
+    return result;
+}
+
+GraphicsImage *AssetsManager::insertImage(std::unordered_map<std::string, GraphicsImage *> *map,
+                                          const std::string &name, std::unique_ptr<ImageLoader> loader) {
+    assert(!map->contains(name));
+
+    GraphicsImage *result = GraphicsImage::Create(std::move(loader));
+    assetCache->insert(result);
+    assetCache->recordMiss();
+    (*map)[name] = result;
+    return result;
+}
+
+void AssetsManager::startPrefetch(ThreadPool *pool) {
+    assert(pool);
+
+    // Leftovers from a level load that was interrupted by an exception.
+    for (std::future<PrefetchedBitmap> &future : _prefetchedBitmaps)
+        future.wait();
+    _prefetchedBitmaps.clear();
+
+    _prefetchPool = pool;
+    for (const auto &[name, image] : bitmaps) {
+        if (image->isLoaded() || !dynamic_cast<Bitmaps_LOD_Loader *>(image->loader()))
+            continue;
+
+        // Only const LodTextureCache methods are called on worker threads, the cache itself is updated in
+        // finishPrefetch on the main thread.
+        _prefetchedBitmaps.push_back(pool->submit([name = name] {
+            PrefetchedBitmap result;
+            result.name = name;
+            result.texture = pBitmaps_LOD->decodeTexture(name);
+            if (result.texture)
+                result.rgba = Bitmaps_LOD_Loader::convert(*result.texture, name);
+            return result;
+        }));
+    }
+}
+
+void AssetsManager::finishPrefetch() {
+    assert(_prefetchPool);
+
+    std::vector<GraphicsImage *> loaded;
+
+    std::vector<std::future<PrefetchedBitmap>> prefetchedBitmaps = std::move(_prefetchedBitmaps);
+    _prefetchedBitmaps.clear();
+    for (std::future<PrefetchedBitmap> &future : prefetchedBitmaps) {
+        PrefetchedBitmap bitmap = future.get();
+        if (!bitmap.texture)
+            continue; // Will fall back to a dummy texture when loaded lazily.
+
+        pBitmaps_LOD->insertTexture(bitmap.name, std::move(*bitmap.texture));
+
+        // The image might have been released or loaded lazily on the main thread while we were decoding.
+        GraphicsImage *image = valueOr(bitmaps, bitmap.name, nullptr);
+        if (!image || image->isLoaded())
+            continue;
+
+        image->setLoaded(std::move(bitmap.rgba));
+        loaded.push_back(image);
+    }
+
+    // Sprites are already decoded into LodSpriteCache when they're added to a level, so we only need to convert them.
+    std::vector<std::pair<GraphicsImage *, LodSpriteView>> pendingSprites;
+    for (const auto &[name, image] : sprites) {
+        if (image->isLoaded() || !dynamic_cast<Sprites_LOD_Loader *>(image->loader()))
+            continue;
+
+        if (Sprite *sprite = pSprites_LOD->loadSprite(name))
+            pendingSprites.emplace_back(image, sprite->lodSprite);
+    }
+
+    std::vector<RgbaImage> convertedSprites(pendingSprites.size());
+    _prefetchPool->parallelFor(pendingSprites.size(), [&](size_t i) {
+        convertedSprites[i] = Sprites_LOD_Loader::convert(pendingSprites[i].second);
+    });
+
+    for (size_t i = 0; i < pendingSprites.size(); i++) {
+        pendingSprites[i].first->setLoaded(std::move(convertedSprites[i]));
+        loaded.push_back(pendingSprites[i].first);
+    }
+
+    // Texture upload has to happen on the main thread.
+    for (GraphicsImage *image : loaded)
+        (void) image->renderId();
+
+    logger->trace("Prefetched {} bitmaps and {} sprites", loaded.size() - pendingSprites.size(), pendingSprites.size());
+
+    const AssetCacheStats &stats = assetCache->stats();
+    logger->trace("Asset cache: {} assets, {} KiB (peak {} KiB), {} hits, {} misses, {} evictions", stats.assets,
+                  stats.bytes / 1024, stats.peakBytes / 1024, stats.hits, stats.misses, stats.evictions);
+}
@@ -3,11 +3,18 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <future>
+#include <optional>
+#include <vector>
 
 #include "Library/Color/ColorTable.h"
+#include "Library/Image/Image.h"
+#include "Library/LodFormats/LodImage.h"
 #include "GUI/GUIFont.h"
 
 class GraphicsImage;
+class ImageLoader;
+class ThreadPool;
 
 class AssetsManager {
  public:
@@ -31,6 +38,23 @@ class AssetsManager {
     GraphicsImage *getBitmap(std::string_view name, bool generated = false);
     GraphicsImage *getSprite(std::string_view name);
 
+    /**
+     * Starts decoding all LOD bitmaps that were requested through `getBitmap`, but are not yet loaded, on the
+     * provided thread pool. This is meant to be called right after the level data is loaded, so that face textures
+     * are decoded while the rest of the level is being set up.
+     *
+     * @param pool                      Thread pool to use.
+     * @see finishPrefetch
+     */
+    void startPrefetch(ThreadPool *pool);
+
+    /**
+     * Waits for the bitmaps from `startPrefetch` and hands them over to the corresponding images, converts all
+     * pending sprites on the same thread pool, and then uploads all of these to the GPU. After this call the first
+     * frames of a level don't need to load anything lazily.
+     */
+    void finishPrefetch();
+
     std::unique_ptr<GUIFont> pFontBookOnlyShadow;
     std::unique_ptr<GUIFont> pFontBookLloyds;
     std::unique_ptr<GUIFont> pFontArrus;
@@ -46,6 +70,30 @@ class AssetsManager {
     std::unordered_map<std::string, GraphicsImage *> bitmaps;
     std::unordered_map<std::string, GraphicsImage *> sprites;
     std::unordered_map<std::string, GraphicsImage *> images;
+
+ private:
+    /**
+     * Looks up an image & records a hit in the global `AssetCache` if found.
+     */
+    static GraphicsImage *findImage(const std::unordered_map<std::string, GraphicsImage *> &map,
+                                    const std::string &name);
+
+    /**
+     * Creates a lazily loaded image, adds it to the map and registers it in the global `AssetCache`.
+     */
+    static GraphicsImage *insertImage(std::unordered_map<std::string, GraphicsImage *> *map, const std::string &name,
+                                      std::unique_ptr<ImageLoader> loader);
+
+ private:
+    struct PrefetchedBitmap {
+        std::string name;
+        std::optional<LodImage> texture; // std::nullopt if there's no such bitmap in the LOD.
+        RgbaImage rgba;
+    };
+
+ private:
+    ThreadPool *_prefetchPool = nullptr;
+    std::vector<std::future<PrefetchedBitmap>> _prefetchedBitmaps;
 };
 
 extern AssetsManager *assets;
@@ -1,6 +1,8 @@
 #include <cstring>
 #include <cstdlib>
+#include <chrono>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <memory>
 
@@ -32,6 +34,7 @@
 #include "Engine/Graphics/Vis.h"
 #include "Engine/Graphics/Weather.h"
 #include "Engine/Graphics/TurnBasedOverlay.h"
+#include "Engine/Resources/AssetCache.h"
 #include "Engine/Resources/LodTextureCache.h"
 #include "Engine/Resources/LodSpriteCache.h"
 #include "Engine/Localization.h"
@@ -46,6 +49,7 @@
 #include "Engine/Random/Random.h"
 #include "Engine/SaveLoad.h"
 #include "Engine/Snapshots/TableSerialization.h"
+#include "Engine/Snapshots/TextTableCache.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Spells/CastSpellInfo.h"
 #include "Engine/Spells/Spells.h"
@@ -87,6 +91,8 @@
 #include "Library/BuildInfo/BuildInfo.h"
 #include "Tables/ChestTable.h"
 
+#include "Utility/Concurrency/TaskGraph.h"
+#include "Utility/Concurrency/ThreadPool.h"
 #include "Utility/String/Transformations.h"
 #include "TurnEngine/TurnEngine.h"
 
@@ -267,6 +273,10 @@ void Engine::Draw() {
     render->flushAndScale();
     drawOverlay();
     render->swapBuffers();
+
+    // Nothing from this frame is referenced by the renderer anymore, so it's safe to evict assets.
+    assetCache->setBudget(static_cast<size_t>(config->graphics.TextureCacheBudget.value()) * 1024 * 1024);
+    assetCache->endFrame();
 }
 
 
@@ -495,6 +505,7 @@ Engine::Engine(std::shared_ptr<GameConfig> config, OverlaySystem &overlaySystem)
     keyboardActionMapping = ::keyboardActionMapping;
 
     _resourceManager = std::make_unique<ResourceManager>();
+    _threadPool = std::make_unique<ThreadPool>();
 }
 
 //----- (0044E7F3) --------------------------------------------------------
@@ -678,8 +689,6 @@ void FinalInitialization() {
 }
 
 void MM7_LoadLods() {
-    engine->resources()->open();
-
     pIcons_LOD = new LodTextureCache;
     pIcons_LOD->open(dfs->read("data/icons.lod"));
 
@@ -718,52 +727,96 @@ void Engine::MM7_Initialize() {
 
     _statusBar = std::make_unique<StatusBar>();
 
-    MM7_LoadLods();
-
-    localization = new Localization();
-    localization->initialize();
-
-    pSpriteFrameTable = new SpriteFrameTable;
-    deserialize(engine->resources()->eventsData("dsft.bin"), pSpriteFrameTable);
+    // Most of the startup loaders are independent, so we run them in parallel. LODs are opened one after another as
+    // the file system is not thread-safe. Audio & video use OpenAL and stay on the main thread.
+    TaskGraph startup;
+    TaskGraph::TaskId events = startup.add("events.lod", [] { engine->resources()->open(); });
+    startup.add("lods", [] { MM7_LoadLods(); }, {events});
+    startup.add("localization", [] {
+        localization = new Localization();
+        localization->initialize();
+    }, {events});
+
+    auto addTable = [&]<class T>(std::string_view fileName, T **table) {
+        startup.add(std::string(fileName), [fileName, table] {
+            *table = new T;
+            deserialize(engine->resources()->eventsData(fileName), *table);
+        }, {events});
+    };
+    addTable("dsft.bin", &pSpriteFrameTable);
+    addTable("dtft.bin", &pTextureFrameTable);
+    addTable("dtile.bin", &pTileTable);
+    addTable("dpft.bin", &pPortraitFrameTable);
+    addTable("dift.bin", &pIconsFrameTable);
+    addTable("ddeclist.bin", &pDecorationList);
+    addTable("dobjlist.bin", &pObjectList);
+    addTable("dmonlist.bin", &pMonsterList);
+    addTable("doverlay.bin", &pOverlayList);
+    addTable("dsounds.bin", &pSoundList);
+
+    TaskGraph::Clock::time_point startupStart = TaskGraph::Clock::now();
+    startup.run(threadPool());
+    auto toMs = [](TaskGraph::Clock::duration duration) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    };
+    for (TaskGraph::TaskId id = 0; id < startup.size(); id++)
+        logger->info("Startup task '{}' took {}ms", startup.name(id), toMs(startup.duration(id)));
+    logger->info("Startup tasks took {}ms in total", toMs(TaskGraph::Clock::now() - startupStart));
 
-    pTextureFrameTable = new TextureFrameTable;
-    deserialize(engine->resources()->eventsData("dtft.bin"), pTextureFrameTable);
+    pMediaPlayer = new MPlayer(); // Creates the OpenAL context that the audio player needs.
 
-    pTileTable = new TileTable;
-    deserialize(engine->resources()->eventsData("dtile.bin"), pTileTable);
+    if (!config->debug.NoSound.value())
+        pAudioPlayer->Initialize();
 
-    pPortraitFrameTable = new PortraitFrameTable;
-    deserialize(engine->resources()->eventsData("dpft.bin"), pPortraitFrameTable);
+    pMediaPlayer->Initialize();
 
-    pIconsFrameTable = new IconFrameTable;
-    deserialize(engine->resources()->eventsData("dift.bin"), pIconsFrameTable);
+    pTileGenerator = new TileGenerator();
+    if (engine->config->graphics.GenerateTiles.value())
+        pTileGenerator->fillTable();
 
-    pDecorationList = new DecorationList;
-    deserialize(engine->resources()->eventsData("ddeclist.bin"), pDecorationList);
+    dword_6BE364_game_settings_1 |= GAME_SETTINGS_4000;
+}
 
-    pObjectList = new ObjectList;
-    deserialize(engine->resources()->eventsData("dobjlist.bin"), pObjectList);
+static void parseTextTables(ResourceManager *resourceManager) {
+    pItemTable->Initialize(resourceManager);
+    pNPCStats->Initialize(resourceManager);
 
-    pMonsterList = new MonsterList;
-    deserialize(engine->resources()->eventsData("dmonlist.bin"), pMonsterList);
+    initializeHouses(resourceManager->eventsData("2dEvents.txt"));
+    initializeQuests(resourceManager->eventsData("quests.txt"));
+    initializeAutonotes(resourceManager->eventsData("autonote.txt"));
+    initializeAwards(resourceManager->eventsData("awards.txt"));
+    initializeTransitions(resourceManager->eventsData("trans.txt"));
+    initializeMerchants(resourceManager->eventsData("merchant.txt"));
+}
 
-    pOverlayList = new OverlayList;
-    deserialize(engine->resources()->eventsData("doverlay.bin"), pOverlayList);
+static void initializeTextTables(ResourceManager *resourceManager, bool useCache) {
+    static constexpr std::string_view cachePath = "generated/text_tables.bin";
 
-    pSoundList = new SoundList;
-    deserialize(engine->resources()->eventsData("dsounds.bin"), pSoundList);
+    pItemTable = new ItemTable();
+    pNPCStats = new NPCStats();
 
-    if (!config->debug.NoSound.value())
-        pAudioPlayer->Initialize();
+    if (!useCache) {
+        parseTextTables(resourceManager);
+        return;
+    }
 
-    pMediaPlayer = new MPlayer();
-    pMediaPlayer->Initialize();
+    uint64_t key = textTablesCacheKey(resourceManager);
+    if (ufs->exists(cachePath) && loadTextTablesCache(ufs->read(cachePath), key)) {
+        // Item sizes depend on the icon textures and thus are not cached.
+        Item::PopulateSpecialBonusMap();
+        Item::PopulateArtifactBonusMap();
+        pItemTable->LoadItemSizes();
+        return;
+    }
 
-    pTileGenerator = new TileGenerator();
-    if (engine->config->graphics.GenerateTiles.value())
-        pTileGenerator->fillTable();
+    // Failed load might have left the tables in a half-overwritten state, so we start from scratch.
+    delete pItemTable;
+    delete pNPCStats;
+    pItemTable = new ItemTable();
+    pNPCStats = new NPCStats();
 
-    dword_6BE364_game_settings_1 |= GAME_SETTINGS_4000;
+    parseTextTables(resourceManager);
+    ufs->write(cachePath, saveTextTablesCache(key));
 }
 
 //----- (00465D0B) --------------------------------------------------------
@@ -786,10 +839,7 @@ void Engine::SecondaryInitialization() {
     pHistoryTable = new HistoryTable();
     pHistoryTable->Initialize(engine->resources()->eventsData("history.txt"));
 
-    pItemTable = new ItemTable();
-    pItemTable->Initialize(engine->resources());
-
-    initializeHouses(engine->resources()->eventsData("2dEvents.txt"));
+    initializeTextTables(engine->resources(), engine->config->debug.TextTableCache.value());
 
     //pPaletteManager->SetMistColor(128, 128, 128);
     //pPaletteManager->RecalculateAll();
@@ -812,14 +862,6 @@ void Engine::SecondaryInitialization() {
 
     spell_fx_renedrer->LoadAnimations();
 
-    pNPCStats = new NPCStats();
-    pNPCStats->Initialize(engine->resources());
-
-    initializeQuests(engine->resources()->eventsData("quests.txt"));
-    initializeAutonotes(engine->resources()->eventsData("autonote.txt"));
-    initializeAwards(engine->resources()->eventsData("awards.txt"));
-    initializeTransitions(engine->resources()->eventsData("trans.txt"));
-    initializeMerchants(engine->resources()->eventsData("merchant.txt"));
     initializeMessageScrolls(engine->resources()->eventsData("scroll.txt"));
     initializeChests();
 
@@ -39,6 +39,7 @@ struct OutdoorLocation;
 struct LightsStack_StationaryLight_;
 struct LightsStack_MobileLight_;
 class OverlaySystem;
+class ThreadPool;
 
 enum class GameState {
     GAME_STATE_PLAYING = 0,
@@ -73,6 +74,15 @@ class Engine {
         return _resourceManager.get();
     }
 
+    /**
+     * @return                          Engine-wide worker thread pool. Code running on the pool must not touch engine
+     *                                  state that's being modified concurrently, use it for read-only queries and
+     *                                  self-contained jobs.
+     */
+    ThreadPool *threadPool() const {
+        return _threadPool.get();
+    }
+
     void Initialize();
     Vis_PIDAndDepth PickMouse(float fPickDepth, int uMouseX, int uMouseY,
                               Vis_SelectionFilter *sprite_filter, Vis_SelectionFilter *face_filter);
@@ -145,6 +155,7 @@ class Engine {
 
  private:
     std::unique_ptr<ResourceManager> _resourceManager;
+    std::unique_ptr<ThreadPool> _threadPool;
 };
 
 extern Engine *engine;
@@ -113,21 +113,12 @@ static tl::generator<Character &> iterateCharacters(EvtTargetCharacter who, Rand
 }
 
 int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
-    EvtInstruction ir;
-    bool stepFound = false;
-
-    for (const EvtInstruction &irTmp : _events) {
-        if (irTmp.step == step) {
-            ir = irTmp;
-            stepFound = true;
-            break;
-        }
-    }
-
-    if (!stepFound) {
+    if (step < 0 || step >= _stepIndices.size() || _stepIndices[step] == -1) {
         return -1;
     }
 
+    const EvtInstruction &ir = _events[_stepIndices[step]];
+
     // In NPC mode must process only NPC dialogue related events plus Exit
     if (isNpc) {
         switch (ir.opcode) {
@@ -188,14 +179,15 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             break;
         case EVENT_MoveToMap:
         {
-            if (ir.data.move_map_descr.house_id != HOUSE_INVALID || ir.data.move_map_descr.exit_pic_id) {
+            EvtInstruction moveIr = ir; // Copy, the hacks below patch it for some maps.
+            if (moveIr.data.move_map_descr.house_id != HOUSE_INVALID || moveIr.data.move_map_descr.exit_pic_id) {
                 // TODO(pskelton): Fix #1890 this should be a data mod
                 if (engine->_indoor->filename == "d20.blv" && _eventId == 501)
-                    ir.data.move_map_descr.z = 3088;
+                    moveIr.data.move_map_descr.z = 3088;
 
-                pDialogueWindow = new GUIWindow_IndoorEntryExit(ir.data.move_map_descr.house_id, ir.data.move_map_descr.exit_pic_id,
-                                                                Vec3f(ir.data.move_map_descr.x, ir.data.move_map_descr.y, ir.data.move_map_descr.z),
-                                                                ir.data.move_map_descr.yaw, ir.data.move_map_descr.pitch, ir.data.move_map_descr.zspeed, ir.str);
+                pDialogueWindow = new GUIWindow_IndoorEntryExit(moveIr.data.move_map_descr.house_id, moveIr.data.move_map_descr.exit_pic_id,
+                                                                Vec3f(moveIr.data.move_map_descr.x, moveIr.data.move_map_descr.y, moveIr.data.move_map_descr.z),
+                                                                moveIr.data.move_map_descr.yaw, moveIr.data.move_map_descr.pitch, moveIr.data.move_map_descr.zspeed, moveIr.str);
                 savedEventID = _eventId;
                 savedEventStep = step + 1;
                 return -1;
@@ -203,15 +195,15 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
 
             // TODO(pskelton): Fix #2117 this should be a data mod - stop it overwriting the teleport point
             if (!(engine->_indoor->filename == "d25.blv" && _eventId == 451 && engine->_teleportPoint.isValid()))
-                engine->_teleportPoint.setTeleportTarget(Vec3f(ir.data.move_map_descr.x, ir.data.move_map_descr.y, ir.data.move_map_descr.z),
-                                                     (ir.data.move_map_descr.yaw != -1) ? (ir.data.move_map_descr.yaw & TrigLUT.uDoublePiMask) : -1,
-                                                     ir.data.move_map_descr.pitch, ir.data.move_map_descr.zspeed);
+                engine->_teleportPoint.setTeleportTarget(Vec3f(moveIr.data.move_map_descr.x, moveIr.data.move_map_descr.y, moveIr.data.move_map_descr.z),
+                                                     (moveIr.data.move_map_descr.yaw != -1) ? (moveIr.data.move_map_descr.yaw & TrigLUT.uDoublePiMask) : -1,
+                                                     moveIr.data.move_map_descr.pitch, moveIr.data.move_map_descr.zspeed);
 
             // TODO(pskelton): Fix #2117 this should be a data mod
-            if (engine->_indoor->filename == "d25.blv" && _eventId == 451 && ir.step == 1)
-                ir.str = "out06.odm";
+            if (engine->_indoor->filename == "d25.blv" && _eventId == 451 && moveIr.step == 1)
+                moveIr.str = "out06.odm";
 
-            if (ir.str[0] == '0') { // teleport within map
+            if (moveIr.str[0] == '0') { // teleport within map
                 if (engine->_teleportPoint.isValid()) {
                     engine->_teleportPoint.doTeleport(false);
                     engine->_teleportPoint.invalidate();
@@ -219,7 +211,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
                 }
             } else {
                 pGameLoadingUI_ProgressBar->Initialize((GUIProgressBar::Type)((activeLevelDecoration == NULL) + 1));
-                Transition_StopSound_Autosave(ir.str, MAP_START_POINT_PARTY);
+                Transition_StopSound_Autosave(moveIr.str, MAP_START_POINT_PARTY);
                 _mapExitTriggered = true;
                 if (current_screen_type == SCREEN_HOUSE) {
                     if (uGameState == GAME_STATE_CHANGE_LOCATION) {
@@ -652,9 +644,11 @@ void EvtInterpreter::prepare(const EvtProgram &eventMap, int eventId, Pid object
     _canShowMessages = canShowMessages;
     _objectPid = objectPid;
 
-    _events.clear();
+    _events = {};
+    _stepIndices = {};
     if (eventMap.hasEvent(eventId)) {
         _events = eventMap.function(eventId);
+        _stepIndices = eventMap.stepIndices(eventId);
     }
 }
 
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <vector>
+#include <span>
 
 #include "Engine/Pid.h"
 #include "Engine/Evt/EvtInstruction.h"
@@ -22,7 +22,8 @@ class EvtInterpreter {
 
  private:
      int _eventId = 0;
-     std::vector<EvtInstruction> _events;
+     std::span<const EvtInstruction> _events; // Points into the `EvtProgram` passed to `prepare`.
+     std::span<const int> _stepIndices; // See `EvtProgram::stepIndices`.
      Pid _objectPid = Pid();
      bool _canShowMessages = false;
      bool _canShowOption = true;
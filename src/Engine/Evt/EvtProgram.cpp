@@ -38,22 +38,39 @@ EvtProgram EvtProgram::load(const Blob &rawData) {
 }
 
 void EvtProgram::add(int eventId, EvtInstruction ir) {
-    _eventsById[eventId].push_back(std::move(ir));
+    Function &function = _functionsById[eventId];
+
+    if (ir.step >= 0) {
+        if (ir.step >= function.indexByStep.size())
+            function.indexByStep.resize(ir.step + 1, -1);
+        if (function.indexByStep[ir.step] == -1)
+            function.indexByStep[ir.step] = function.instructions.size();
+    }
+
+    function.instructions.push_back(std::move(ir));
 }
 
 void EvtProgram::clear() {
-    _eventsById.clear();
+    _functionsById.clear();
 }
 
 const EvtInstruction &EvtProgram::instruction(int eventId, int step) const {
-    for (const EvtInstruction &ir : function(eventId))
-        if (ir.step == step)
-            return ir;
-    throw Exception("Event {}:{} not found", eventId, step);
+    const Function &function = functionData(eventId);
+    if (step < 0 || step >= function.indexByStep.size() || function.indexByStep[step] == -1)
+        throw Exception("Event {}:{} not found", eventId, step);
+    return function.instructions[function.indexByStep[step]];
+}
+
+std::span<const EvtInstruction> EvtProgram::function(int eventId) const {
+    return functionData(eventId).instructions;
+}
+
+std::span<const int> EvtProgram::stepIndices(int eventId) const {
+    return functionData(eventId).indexByStep;
 }
 
-const std::vector<EvtInstruction>& EvtProgram::function(int eventId) const {
-    const auto *result = valuePtr(_eventsById, eventId);
+const EvtProgram::Function &EvtProgram::functionData(int eventId) const {
+    const Function *result = valuePtr(_functionsById, eventId);
     if (!result)
         throw Exception("Event {} not found", eventId);
     return *result;
@@ -62,8 +79,8 @@ const std::vector<EvtInstruction>& EvtProgram::function(int eventId) const {
 std::vector<EventTrigger> EvtProgram::enumerateTriggers(EvtOpcode triggerType) {
     std::vector<EventTrigger> result;
 
-    for (const auto &[id, events] : _eventsById) {
-        for (const EvtInstruction &event : events) {
+    for (const auto &[id, function] : _functionsById) {
+        for (const EvtInstruction &event : function.instructions) {
             // As retarded as it might look, there are scripts that have THREE EVENT_OnLongTimer instructions.
             // Thus, we might have several event triggers for the same event id.
             if (event.opcode == triggerType) {
@@ -81,23 +98,23 @@ std::vector<EventTrigger> EvtProgram::enumerateTriggers(EvtOpcode triggerType) {
 }
 
 bool EvtProgram::hasHint(int eventId) const {
-    const auto* events = valuePtr(_eventsById, eventId);
-    if (!events || events->size() < 2)
+    const Function *function = valuePtr(_functionsById, eventId);
+    if (!function || function->instructions.size() < 2)
         return false;
 
-    return (*events)[0].opcode == EVENT_MouseOver && (*events)[1].opcode == EVENT_Exit;
+    return function->instructions[0].opcode == EVENT_MouseOver && function->instructions[1].opcode == EVENT_Exit;
 }
 
 std::string EvtProgram::hint(int eventId) const {
     std::string result;
     bool mouseOverFound = false;
 
-    const auto* events = valuePtr(_eventsById, eventId);
-    if (!events) { // no entry in .evt file
+    const Function *function = valuePtr(_functionsById, eventId);
+    if (!function) { // no entry in .evt file
         return result;
     }
 
-    for (const EvtInstruction &ir : *events) {
+    for (const EvtInstruction &ir : function->instructions) {
         if (ir.opcode == EVENT_MouseOver) {
             mouseOverFound = true;
             if (ir.data.text_id < engine->_levelStrings.size()) {
@@ -116,10 +133,10 @@ std::string EvtProgram::hint(int eventId) const {
 }
 
 void EvtProgram::dump(int eventId) const {
-    const auto *events = valuePtr(_eventsById, eventId);
-    if (events) {
+    const Function *function = valuePtr(_functionsById, eventId);
+    if (function) {
         logger->trace("Event: {}", eventId);
-        for (const EvtInstruction &ir : *events) {
+        for (const EvtInstruction &ir : function->instructions) {
             logger->trace("{}", ir.toString());
         }
     } else {
@@ -128,7 +145,7 @@ void EvtProgram::dump(int eventId) const {
 }
 
 void EvtProgram::dumpAll() const {
-    for (const auto &[id, _] : _eventsById) {
+    for (const auto &[id, _] : _functionsById) {
         dump(id);
     }
 }
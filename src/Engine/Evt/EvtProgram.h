@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -21,7 +22,7 @@ class EvtProgram {
     void clear();
 
     bool hasEvent(int eventId) const {
-        return _eventsById.contains(eventId);
+        return _functionsById.contains(eventId);
     }
 
     /**
@@ -34,10 +35,21 @@ class EvtProgram {
 
     /**
      * @param eventId                   Event id.
-     * @return                          Reference to a list of events for the provided `eventId`.
+     * @return                          List of instructions for the provided `eventId`. The returned span points into
+     *                                  this program and stays valid until it's modified.
      * @throws Exception                If there are no events for the provided `eventId`.
      */
-    const std::vector<EvtInstruction>& function(int eventId) const;
+    std::span<const EvtInstruction> function(int eventId) const;
+
+    /**
+     * @param eventId                   Event id.
+     * @return                          Step to instruction index table for the provided `eventId`. Element at `step`
+     *                                  is the index of the first instruction with this step in `function(eventId)`,
+     *                                  or -1 if there is no such instruction. Steps past the end of the table don't
+     *                                  exist either.
+     * @throws Exception                If there are no events for the provided `eventId`.
+     */
+    std::span<const int> stepIndices(int eventId) const;
 
     /**
      * @param triggerType               Event type to look for.
@@ -63,5 +75,13 @@ class EvtProgram {
     void dump(int eventId) const;
 
  private:
-    std::unordered_map<int, std::vector<EvtInstruction>> _eventsById;
+    struct Function {
+        std::vector<EvtInstruction> instructions;
+        std::vector<int> indexByStep; // See `stepIndices`. Updated in `add`, so that jumps don't need linear lookups.
+    };
+
+    const Function &functionData(int eventId) const;
+
+ private:
+    std::unordered_map<int, Function> _functionsById;
 };
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "Engine/Evt/Processor.h"
 #include "Engine/Objects/DecorationList.h"
@@ -450,17 +451,24 @@ void CollideIndoorWithGeometry(bool ignore_ethereal) {
 }
 
 void CollideOutdoorWithModels(bool ignore_ethereal) {
+    static std::vector<int> faceIds; // Reused between calls so that we don't allocate on every collision iteration.
+
     for (BSPModel &model : pOutdoor->pBModels) {
         if (!collision_state.bbox.intersects(model.pBoundingBox))
             continue;
 
-        for (ODMFace &mface : model.pFaces) {
-            if (!collision_state.bbox.intersects(mface.pBoundingBox))
-                continue;
+        // Tree returns faces in arbitrary order, but collision results depend on face order when distances are equal.
+        ODMCollisionModel &collisionModel = pOutdoor->collisionModels[model.index];
+        faceIds.clear();
+        collisionModel.faceTree.forEachIntersecting(collision_state.bbox, [&](int faceId) { faceIds.push_back(faceId); });
+        std::ranges::sort(faceIds);
+
+        for (int faceId : faceIds) {
+            ODMFace &mface = model.pFaces[faceId];
 
             // TODO: we should really either merge two face classes, or template the functions down the chain call here.
-            BLVFace face;
-            face.FromODM(&mface);
+            BLVFace &face = pOutdoor->collisionFaces[collisionModel.firstFace + faceId];
+            face.uAttributes = mface.uAttributes; // Attributes can be changed by scripts, so we need to re-sync them.
 
             if (face.Ethereal() || face.isPortal()) // TODO: this doesn't respect ignore_ethereal parameter
                 continue;
@@ -37,22 +37,42 @@ GraphicsImage *GraphicsImage::Create(std::unique_ptr<ImageLoader> loader) {
 }
 
 int GraphicsImage::width() {
-    return rgba().width();
+    touch();
+    initialize();
+    return _rgba.width();
 }
 
 int GraphicsImage::height() {
-    return rgba().height();
+    touch();
+    initialize();
+    return _rgba.height();
 }
 
 Sizei GraphicsImage::size() {
-    return rgba().size();
+    touch();
+    initialize();
+    return _rgba.size();
 }
 
 RgbaImage &GraphicsImage::rgba() {
+    touch();
     initialize();
     return _rgba;
 }
 
+void GraphicsImage::setLoaded(RgbaImage image) {
+    assert(!_initialized && !_renderId);
+
+    _rgba = std::move(image);
+    _initialized = true;
+    updateCachedBytes();
+}
+
+size_t GraphicsImage::memoryUsage() const {
+    size_t bytes = _rgba.width() * _rgba.height() * sizeof(Color);
+    return _renderId ? bytes * 2 : bytes;
+}
+
 const std::string &GraphicsImage::name() {
     return _name;
 }
@@ -70,9 +90,11 @@ void GraphicsImage::release() {
 }
 
 [[nodiscard]] TextureRenderId GraphicsImage::renderId() {
+    touch();
     if (!_renderId) {
         initialize();
         _renderId = render->CreateTexture(_rgba);
+        updateCachedBytes();
     }
 
     return _renderId;
@@ -84,6 +106,7 @@ void GraphicsImage::releaseRenderId() {
 
     render->DeleteTexture(_renderId);
     _renderId = TextureRenderId();
+    updateCachedBytes();
 }
 
 bool GraphicsImage::initialize() {
@@ -91,8 +114,25 @@ bool GraphicsImage::initialize() {
         return true;
 
     assert(_loader);
+    if (_evicted && cache())
+        cache()->recordMiss();
     _initialized = _loader->Load(&_rgba);
     // TODO(captainurist): _initialized == false happens, investigate
+    updateCachedBytes();
 
     return _initialized;
 }
+
+void GraphicsImage::updateCachedBytes() {
+    setCachedBytes(memoryUsage());
+}
+
+void GraphicsImage::evict() {
+    assert(_loader); // Images w/o a loader can't be reloaded, and thus shouldn't be in the cache.
+
+    releaseRenderId();
+    _rgba = RgbaImage();
+    _initialized = false;
+    _evicted = true;
+    updateCachedBytes();
+}
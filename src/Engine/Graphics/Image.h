@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "Engine/Graphics/Renderer/TextureRenderId.h"
+#include "Engine/Resources/AssetCache.h"
 
 #include "Library/Geometry/Size.h"
 #include "Library/Image/Image.h"
@@ -11,7 +12,13 @@
 
 class ImageLoader;
 
-class GraphicsImage {
+/**
+ * Lazily loaded image, with an optional GPU texture.
+ *
+ * Images that have a loader are evictable - when registered in an `AssetCache` they might lose both the pixel data and
+ * the GPU texture between frames. These are then reloaded on next access, so pointers to such images stay valid.
+ */
+class GraphicsImage : public CachedAsset {
  public:
     static GraphicsImage *Create(RgbaImage image);
     static GraphicsImage *Create(int width, int height);
@@ -24,6 +31,33 @@ class GraphicsImage {
 
     RgbaImage &rgba();
 
+    /**
+     * @return                          Whether the pixel data for this image is already loaded.
+     */
+    [[nodiscard]] bool isLoaded() const {
+        return _initialized;
+    }
+
+    /**
+     * @return                          Loader for this image, if any.
+     */
+    [[nodiscard]] ImageLoader *loader() const {
+        return _loader.get();
+    }
+
+    /**
+     * Sets the pixel data for a lazily loaded image that was loaded elsewhere, e.g. on a worker thread. The loader
+     * won't be invoked after this call.
+     *
+     * @param image                     Loaded image, must be the same as what the loader would have returned.
+     */
+    void setLoaded(RgbaImage image);
+
+    /**
+     * @return                          Memory used by this image, including the GPU texture.
+     */
+    [[nodiscard]] size_t memoryUsage() const;
+
     const std::string &name();
 
     void release(); // TODO(captainurist): drop
@@ -36,9 +70,12 @@ class GraphicsImage {
     ~GraphicsImage(); // Call Release() instead.
 
     bool initialize();
+    void updateCachedBytes();
+    void evict() override;
 
  private:
     bool _initialized = false;
+    bool _evicted = false;
     std::string _name;
     std::unique_ptr<ImageLoader> _loader;
     RgbaImage _rgba;
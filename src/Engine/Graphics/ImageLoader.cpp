@@ -6,7 +6,6 @@
 #include <utility>
 
 #include "Engine/Engine.h"
-#include "Engine/Resources/EngineFileSystem.h"
 #include "Engine/Graphics/AtlasLayout.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Graphics/Sprites.h"
@@ -15,9 +14,10 @@
 #include "Engine/Resources/LodSpriteCache.h"
 #include "Engine/Graphics/PaletteManager.h"
 
+#include "Library/Color/ColorKernels.h"
 #include "Library/Image/ImageFunctions.h"
+#include "Library/Image/ImageKernels.h"
 #include "Library/Image/Pcx.h"
-#include "Library/Image/Png.h"
 #include "Library/LodFormats/LodImage.h"
 #include "Library/LodFormats/LodSprite.h"
 #include "Library/Logger/Logger.h"
@@ -150,8 +150,7 @@ bool Buff_LOD_Loader::Load(RgbaImage *rgbaImage) {
 
         Recti cell = layout[i];
         for (int y = 0; y < cell.h; y++)
-            for (int x = 0; x < cell.w; x++)
-                result[y + cell.y][x + cell.x] = palette.colors[tex->image[y][x]];
+            expandPalette(tex->image[y], palette, result[y + cell.y].subspan(cell.x, cell.w));
     }
 
     *rgbaImage = std::move(result);
@@ -183,116 +182,53 @@ bool PCX_LOD_Compressed_Loader::Load(RgbaImage *rgbaImage) {
 
     bool result = InternalLoad(pcx_data, rgbaImage);
 
-    for (Color &pixel : rgbaImage->pixels())
-        if (pixel == colorkey)
-            pixel = Color();
+    replaceColor(rgbaImage->pixels(), colorkey, Color());
 
     return result;
 }
 
-static Color ProcessTransparentPixel(const GrayscaleImage &image, const Palette &palette, size_t x, size_t y) {
-    size_t count = 0;
-    size_t r = 0, g = 0, b = 0;
-
-    auto processPixel = [&](size_t x, size_t y) {
-        uint8_t pal = image[y][x];
-        if (pal != 0) {
-            count++;
-            r += palette.colors[pal].r;
-            g += palette.colors[pal].g;
-            b += palette.colors[pal].b;
-        }
-    };
-
-    bool canDecX = x > 0;
-    bool canIncX = x < image.width() - 1;
-    bool canDecY = y > 0;
-    bool canIncY = y < image.height() - 1;
-
-    if (canDecX && canDecY)
-        processPixel(x - 1, y - 1);
-    if (canDecX)
-        processPixel(x - 1, y);
-    if (canDecX && canIncY)
-        processPixel(x - 1, y + 1);
-    if (canDecY)
-        processPixel(x, y - 1);
-    if (canIncY)
-        processPixel(x, y + 1);
-    if (canIncX && canDecY)
-        processPixel(x + 1, y - 1);
-    if (canIncX)
-        processPixel(x + 1, y);
-    if (canIncX && canIncY)
-        processPixel(x + 1, y + 1);
-
-    if (count != 0) {
-        r /= count;
-        g /= count;
-        b /= count;
-    }
-
-    return Color(static_cast<uint8_t>(r), static_cast<uint8_t>(g), static_cast<uint8_t>(b), 0);
-}
-
 bool Bitmaps_LOD_Loader::Load(RgbaImage *rgbaImage) {
-    LodImage *tex = lod->loadTexture(this->resource_name);
-
-    size_t w = tex->image.width();
-    size_t h = tex->image.height();
+    *rgbaImage = convert(*lod->loadTexture(this->resource_name), this->resource_name);
+    return true;
+}
 
+RgbaImage Bitmaps_LOD_Loader::convert(const LodImage &texture, std::string_view name) {
     // Desaturate bitmaps
-    Palette palette = PaletteManager::createLoadedPalette(tex->palette);
+    Palette palette = PaletteManager::createLoadedPalette(texture.palette);
 
-    if (!transparentTextures.contains(this->resource_name)) {
-        *rgbaImage = makeRgbaImage(tex->image, palette);
-    } else {
-        palette = MakePaletteAlpha(palette);
-
-        *rgbaImage = RgbaImage::uninitialized(w, h);
-        for (size_t y = 0; y < h; y++) {
-            for (size_t x = 0; x < w; x++) {
-                uint8_t pal = tex->image[y][x];
-                if (pal == 0) {
-                    (*rgbaImage)[y][x] = ProcessTransparentPixel(tex->image, palette, x, y);
-                } else {
-                    (*rgbaImage)[y][x] = palette.colors[pal];
-                }
-            }
-        }
-    }
-
-    return true;
+    RgbaImage result = makeRgbaImage(texture.image, palette);
+    if (transparentTextures.contains(name))
+        bleedTransparentPixels(texture.image, palette, &result);
+    return result;
 }
 
 bool Bitmaps_GEN_Loader::Load(RgbaImage *rgbaImage) {
-    pTileGenerator->ensureTile(this->resource_name);
-    *rgbaImage = png::decode(ufs->read(this->resource_name));
+    RgbaImageView tile = pTileGenerator->tile(this->resource_name);
+    *rgbaImage = RgbaImage::copy(tile.pixels().data(), tile.width(), tile.height());
 
     // Desaturate.
     float xs = engine->config->graphics.Saturation.value();
     float xv = engine->config->graphics.Lightness.value();
-    for (Color &pixel : rgbaImage->pixels())
-        pixel = pixel.toHsvColorf().adjusted(0, xs, xv).toColor();
+    adjustColors(rgbaImage->pixels(), xs, xv);
 
     return true;
 }
 
 bool Sprites_LOD_Loader::Load(RgbaImage *rgbaImage) {
     Sprite *pSprite = lod->loadSprite(this->resource_name);
+    *rgbaImage = convert(pSprite->lodSprite);
+    return true;
+}
 
-    size_t w = pSprite->sprite_header->image.width();
-    size_t h = pSprite->sprite_header->image.height();
-
-    *rgbaImage = RgbaImage::solid(Color(), w, h);
-
-    for (size_t y = 0; y < h; y++) {
-        for (size_t x = 0; x < w; x++) {
-            uint8_t index = pSprite->sprite_header->image[y][x];
-            (*rgbaImage)[y][x] = Color(index, 0, 0, index == 0 ? 0 : 255);
-        }
-    }
+RgbaImage Sprites_LOD_Loader::convert(LodSpriteView sprite) {
+    // Sprites are palettized in the shader, so we just store the palette index in the red channel.
+    static const Palette indexPalette = [] {
+        Palette result;
+        for (size_t i = 0; i < 256; i++)
+            result.colors[i] = Color(static_cast<uint8_t>(i), 0, 0, i == 0 ? 0 : 255);
+        return result;
+    }();
 
-    return true;
+    return makeRgbaImage(sprite.image, indexPalette);
 }
 
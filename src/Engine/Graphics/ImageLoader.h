@@ -9,6 +9,8 @@
 class LodSpriteCache;
 class LodTextureCache;
 class LodReader;
+struct LodImage;
+struct LodSpriteView;
 
 class ImageLoader {
  public:
@@ -134,6 +136,15 @@ class Bitmaps_LOD_Loader : public ImageLoader {
 
     virtual bool Load(RgbaImage *rgbaImage) override;
 
+    /**
+     * Converts a paletted LOD bitmap into an RGBA image. This function is thread-safe.
+     *
+     * @param texture                   Decoded LOD bitmap.
+     * @param name                      Lowercase bitmap name.
+     * @return                          Converted image, same as what `Load` would return.
+     */
+    [[nodiscard]] static RgbaImage convert(const LodImage &texture, std::string_view name);
+
  protected:
     LodTextureCache *lod;
 };
@@ -156,6 +167,14 @@ class Sprites_LOD_Loader : public ImageLoader {
 
     virtual bool Load(RgbaImage *rgbaImage) override;
 
+    /**
+     * Converts a LOD sprite into an RGBA image. This function is thread-safe.
+     *
+     * @param sprite                    Decoded LOD sprite.
+     * @return                          Converted image, same as what `Load` would return.
+     */
+    [[nodiscard]] static RgbaImage convert(LodSpriteView sprite);
+
  protected:
     LodSpriteCache *lod;
 };
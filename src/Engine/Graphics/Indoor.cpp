@@ -4,6 +4,7 @@
 #include <limits>
 #include <ranges>
 #include <string>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/AssetsManager.h"
@@ -29,6 +30,7 @@
 #include "Engine/Tables/ItemTable.h"
 #include "Engine/OurMath.h"
 #include "Engine/Party.h"
+#include "Engine/SaveLoad.h"
 #include "Engine/Snapshots/CompositeSnapshots.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Time/Timer.h"
@@ -48,6 +50,7 @@
 
 #include "Utility/String/Ascii.h"
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Concurrency/ThreadPool.h"
 #include "Utility/Exception.h"
 
 #include "Io/Mouse.h"
@@ -252,6 +255,9 @@ void IndoorLocation::Release() {
     this->pDoors.clear();
     this->pLights.clear();
     this->pMapOutlines.clear();
+    this->sectorGrid.clear();
+    this->sectorPvs.clear();
+    this->detectionCache.clear();
 
     render->ReleaseBSP();
 
@@ -286,12 +292,15 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
     IndoorLocation_MM7 location;
     deserialize(lod::decodeMaybeCompressed(pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
     reconstruct(location, this);
+    BuildSectorGrid();
+    BuildSectorPvs();
 
     std::string dlv_filename = fmt::format("{}.dlv", filename.substr(0, filename.size() - 4));
 
     bool respawnInitial = false; // Perform initial location respawn?
     bool respawnTimed = false; // Perform timed location respawn?
     IndoorDelta_MM7 delta;
+    FinishPendingSave(dlv_filename);
     if (Blob blob = lod::decodeMaybeCompressed(pSave_LOD->read(dlv_filename))) {
         try {
             deserialize(blob, &delta, tags::context(location));
@@ -340,6 +349,61 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
         dlv.respawnCount++;
 }
 
+void IndoorLocation::BuildSectorGrid() {
+    // GetSector checks sector bounds against a 5x5 xy box around the query point, we pad by one more unit so that
+    // float rounding in that check can't make the grid drop a sector that the check would accept.
+    static constexpr float SECTOR_GRID_PADDING = 6.0f;
+    static constexpr float SECTOR_GRID_CELL_SIZE = 512.0f;
+
+    std::vector<BBoxf> bounds;
+    bounds.reserve(pSectors.size());
+    for (const BLVSector &sector : pSectors) {
+        BBoxf box = sector.pBounding;
+        box.x1 -= SECTOR_GRID_PADDING;
+        box.y1 -= SECTOR_GRID_PADDING;
+        box.x2 += SECTOR_GRID_PADDING;
+        box.y2 += SECTOR_GRID_PADDING;
+        bounds.push_back(box);
+    }
+
+    sectorGrid.build(bounds, SECTOR_GRID_CELL_SIZE);
+}
+
+void IndoorLocation::BuildSectorPvs() {
+    int count = pSectors.size();
+    sectorPvs.assign(count * count, false);
+
+    // Breadth-first search from every sector. Portal geometry is ignored here, so this is a superset of what the
+    // actual ray walk can reach.
+    std::vector<int> depth(count);
+    std::vector<int> queue;
+    queue.reserve(count);
+    for (int from = 0; from < count; from++) {
+        std::fill(depth.begin(), depth.end(), -1);
+        queue.clear();
+
+        depth[from] = 0;
+        queue.push_back(from);
+        for (size_t i = 0; i < queue.size(); i++) {
+            int sectorId = queue[i];
+            sectorPvs[from * count + sectorId] = true;
+            if (depth[sectorId] == MAX_PVS_PORTAL_HOPS)
+                continue;
+
+            const BLVSector &sector = pSectors[sectorId];
+            for (int j = 0; j < sector.uNumPortals; j++) {
+                const BLVFace &portal = pFaces[sector.pPortals[j]];
+                int nextId = portal.uSectorID == sectorId ? portal.uBackSectorID : portal.uSectorID;
+                if (nextId < 0 || nextId >= count || depth[nextId] != -1)
+                    continue;
+
+                depth[nextId] = depth[sectorId] + 1;
+                queue.push_back(nextId);
+            }
+        }
+    }
+}
+
 //----- (0049AC17) --------------------------------------------------------
 int IndoorLocation::GetSector(float sX, float sY, float sZ) {
     if (uCurrentlyLoadedLevelType != LEVEL_INDOOR)
@@ -357,9 +421,10 @@ int IndoorLocation::GetSector(float sX, float sY, float sZ) {
     std::optional<int> foundSector;
     bool singleSectorFound = false;
 
-    // loop through sectors
-    for (unsigned i = 1; i < pSectors.size(); ++i) {
+    // loop through sectors, the grid returns candidates in index order so the results match a full scan
+    for (int i : sectorGrid.candidates(sX, sY)) {
         if (NumFoundFaceStore >= 5) break;
+        if (i == 0) continue;
 
         BLVSector *pSector = &pSectors[i];
 
@@ -665,10 +730,14 @@ void BLV_InitialiseDoors() {
     }
 }
 
+SoundId doorSoundForMap(MapId mapId) {
+    if (mapId == MAP_INVALID)
+        return SOUND_wood_door0101;
+    return pDoorSoundIDsByLocationID[mapId];
+}
+
 void BLV_UpdateDoors() {
-    SoundId eDoorSoundID = SOUND_wood_door0101;
-    if (engine->_currentLoadedMapId != MAP_INVALID)
-        eDoorSoundID = pDoorSoundIDsByLocationID[engine->_currentLoadedMapId];
+    SoundId eDoorSoundID = doorSoundForMap(engine->_currentLoadedMapId);
 
     // loop over all doors
     for (unsigned i = 0; i < pIndoor->pDoors.size(); ++i) {
@@ -716,6 +785,9 @@ void BLV_UpdateDoors() {
 }
 
 void BLV_UpdateDoorGeometry(BLVDoor* door, int distance) {
+    // moving door faces might block or unblock portals
+    pIndoor->detectionCache.clear();
+
     // adjust verts to how open the door is
     for (int j = 0; j < door->uNumVertices; ++j) {
         pIndoor->pVertices[door->pVertexIDs[j]].x = door->vDirection.x * distance + door->pXOffsets[j];
@@ -824,16 +896,84 @@ void switchDoorAnimation(unsigned int uDoorID, DoorAction action) {
 }
 
 //----- (0046F90C) --------------------------------------------------------
+/**
+ * Results of the read-only per-actor floor queries that `BLV_UpdateActors` runs on the thread pool before the serial
+ * update pass. Stored as a structure of arrays indexed by actor id, and reused between frames.
+ */
+struct BLVActorQueries {
+    std::vector<uint8_t> valid; // Not using std::vector<bool> as elements are written from different threads.
+    std::vector<Vec3f> pos; // Query position that the floor was looked up for.
+    std::vector<int> oldSectorId; // Actor's sector id before the query.
+    std::vector<int> sectorId; // Actor's sector id after the query.
+    std::vector<int> faceId;
+    std::vector<float> floorZ;
+
+    void resize(size_t size) {
+        valid.assign(size, false);
+        pos.resize(size);
+        oldSectorId.resize(size);
+        sectorId.resize(size);
+        faceId.resize(size);
+        floorZ.resize(size);
+    }
+};
+
+static BLVActorQueries blvActorQueries;
+
+static bool shouldUpdateActorBLV(const Actor &actor) {
+    return actor.aiState != Removed && actor.aiState != Disabled && actor.aiState != Summoned && actor.moveSpeed != 0;
+}
+
+/**
+ * Phase one of `BLV_UpdateActors`. Runs floor & sector queries for all actors in parallel. These only depend on level
+ * geometry and actor's own position & sector, so running them upfront produces the same results as running them in
+ * the serial loop.
+ */
+static void runActorQueriesBLV() {
+    blvActorQueries.resize(pActors.size());
+    if (!engine->config->debug.ParallelActorQueries.value())
+        return;
+
+    engine->threadPool()->parallelFor(pActors.size(), [](size_t i) {
+        const Actor &actor = pActors[i];
+        if (!shouldUpdateActorBLV(actor))
+            return;
+
+        Vec3f pos = actor.pos + Vec3f(0, 0, actor.radius);
+        int sectorId = actor.sectorId;
+        int faceId;
+        blvActorQueries.pos[i] = pos;
+        blvActorQueries.oldSectorId[i] = sectorId;
+        blvActorQueries.floorZ[i] = GetIndoorFloorZ(pos, &sectorId, &faceId);
+        blvActorQueries.sectorId[i] = sectorId;
+        blvActorQueries.faceId[i] = faceId;
+        blvActorQueries.valid[i] = true;
+    }, 16);
+}
+
 void BLV_UpdateActors() {
     if (engine->config->debug.NoActors.value())
         return;
 
+    runActorQueriesBLV();
+
+    // Phase two, apply the updates in actor order.
     for (Actor &actor : pActors) {
-        if (actor.aiState == Removed || actor.aiState == Disabled || actor.aiState == Summoned || actor.moveSpeed == 0)
+        if (!shouldUpdateActorBLV(actor))
             continue;
 
         int uFaceID;
-        float floorZ = GetIndoorFloorZ(actor.pos + Vec3f(0, 0, actor.radius), &actor.sectorId, &uFaceID);
+        float floorZ;
+        Vec3f queryPos = actor.pos + Vec3f(0, 0, actor.radius);
+        if (blvActorQueries.valid[actor.id] && blvActorQueries.pos[actor.id] == queryPos &&
+            blvActorQueries.oldSectorId[actor.id] == actor.sectorId) {
+            floorZ = blvActorQueries.floorZ[actor.id];
+            uFaceID = blvActorQueries.faceId[actor.id];
+            actor.sectorId = blvActorQueries.sectorId[actor.id];
+        } else {
+            // Actor was moved by the code that ran after the queries, or parallel queries are disabled.
+            floorZ = GetIndoorFloorZ(queryPos, &actor.sectorId, &uFaceID);
+        }
 
         if (actor.sectorId == 0 || floorZ <= -30000 || uFaceID == -1) {
             // TODO(pskelton): asserts trips on test 416 with Dragons OOB - consider running actor check on file load
@@ -968,6 +1108,7 @@ void loadAndPrepareBLV(MapId mapid, bool bLoading) {
 
     pStationaryLightsStack->uNumLightsActive = 0;
     pIndoor->Load(mapFilename, pParty->GetPlayingTime().toDays() + 1, respawn_interval, &indoor_was_respawned);
+    assets->startPrefetch(engine->threadPool());
     if (!(dword_6BE364_game_settings_1 & GAME_SETTINGS_LOADING_SAVEGAME_SKIP_RESPAWN)) {
         Actor::InitializeActors();
         SpriteObject::InitializeSpriteObjects();
@@ -1075,6 +1216,9 @@ void loadAndPrepareBLV(MapId mapid, bool bLoading) {
     this_.monsterInfo.id = MONSTER_ELEMENTAL_LIGHT_C;
     this_.PrepareSprites(0); // TODO(captainurist): can drop this? Was loaded because light elementals can be summoned.
 
+    pAudioPlayer->preloadLevelSounds(engine->threadPool());
+    assets->finishPrefetch();
+
     // Party to start position
     if (!bLoading) {
         pParty->_viewPitch = 0;
@@ -3,13 +3,17 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/mm7_data.h"
 #include "Engine/EngineIocContainer.h"
 #include "Engine/SpawnPoint.h"
 
+#include "Media/Audio/SoundEnums.h"
+
 #include "Library/Geometry/Rect.h"
+#include "Library/Geometry/SpatialGrid.h"
 
 #include "BSPModel.h"
 #include "LocationInfo.h"
@@ -192,8 +196,21 @@ struct BLVSector {  // 0x74
     BBoxf pBounding;
 };
 
+/**
+ * Cached result of `Detect_Between_Objects`, together with the inputs it was computed from.
+ */
+struct BLVDetectionCacheEntry {
+    Vec3f pos1;
+    Vec3f pos2;
+    int sector1 = 0;
+    int sector2 = 0;
+    bool detected = false;
+};
+
 /*   89 */
 struct IndoorLocation {
+    static constexpr int MAX_PVS_PORTAL_HOPS = 30;
+
     //----- (00462592) --------------------------------------------------------
     inline IndoorLocation() {
         this->decal_builder = EngineIocContainer::ResolveDecalBuilder();
@@ -217,6 +234,33 @@ struct IndoorLocation {
     void Load(std::string_view filename, int num_days_played, int respawn_interval_days, bool *indoor_was_respawned);
     void Draw();
 
+    /**
+     * Rebuilds `sectorGrid` from the sector bounding boxes. Sector bounds never change after the level is loaded
+     * (doors only move vertices), so this needs to be called only once per level load.
+     */
+    void BuildSectorGrid();
+
+    /**
+     * Rebuilds `sectorPvs`, the sector-to-sector potentially visible set. Sector `to` is potentially visible from
+     * sector `from` if it can be reached by walking at most `MAX_PVS_PORTAL_HOPS` portals, which is the limit that
+     * `Detect_Between_Objects` uses for its portal walk.
+     */
+    void BuildSectorPvs();
+
+    /**
+     * @param from                      Sector id to look from.
+     * @param to                        Sector id to look at.
+     * @return                          Whether `to` might be visible from `from`. If this returns `false`, then
+     *                                  there is no line of sight between the sectors. Returns `true` for invalid
+     *                                  sector ids.
+     */
+    [[nodiscard]] bool IsSectorPotentiallyVisible(int from, int to) const {
+        int count = pSectors.size();
+        if (from < 0 || to < 0 || from >= count || to >= count || sectorPvs.size() != static_cast<size_t>(count) * count)
+            return true;
+        return sectorPvs[from * count + to];
+    }
+
     /**
      * @offset 0x4488F7
      */
@@ -240,6 +284,9 @@ struct IndoorLocation {
     std::vector<int16_t> ptr_0002B4_doors_ddata;
     std::vector<uint16_t> ptr_0002B8_sector_lrdata;
     std::vector<SpawnPoint> pSpawnPoints;
+    SpatialGrid<float> sectorGrid; // Broad-phase index over sector XY bounds, used by `GetSector`.
+    std::vector<bool> sectorPvs; // pSectors.size() x pSectors.size() matrix, see `BuildSectorPvs`.
+    std::unordered_map<uint32_t, BLVDetectionCacheEntry> detectionCache; // Packed pid pair -> last detection result.
     LocationInfo dlv;
     LocationTime stru1;
     std::array<char, 875> _visible_outlines;
@@ -299,6 +346,13 @@ void BLV_UpdateDoors();
  */
 void BLV_UpdateDoorGeometry(BLVDoor *door, int distance);
 
+/**
+ * @param mapId                         Map to get door sound for, can be `MAP_INVALID`.
+ * @return                              Sound that's played by moving doors on the provided map. Use
+ *                                      `doorClosedSound` to get the sound for a door that has just closed.
+ */
+SoundId doorSoundForMap(MapId mapId);
+
 void BLV_UpdateActors();
 void BLV_ProcessPartyActions();
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -28,6 +29,7 @@
 #include "Engine/Objects/MonsterEnumFunctions.h"
 #include "Engine/OurMath.h"
 #include "Engine/Party.h"
+#include "Engine/SaveLoad.h"
 #include "Engine/Snapshots/CompositeSnapshots.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Tables/ItemTable.h"
@@ -54,6 +56,7 @@
 #include "Utility/String/Ascii.h"
 #include "Utility/Memory/FreeDeleter.h"
 #include "Utility/Math/TrigLut.h"
+#include "Utility/Concurrency/ThreadPool.h"
 #include "Utility/Exception.h"
 
 #include "Io/Mouse.h"
@@ -432,6 +435,10 @@ void OutdoorLocation::Release() {
     this->sky_texture_filename = "sky043";
 
     pBModels.clear();
+    floorFaces.clear();
+    floorGrid.clear();
+    collisionFaces.clear();
+    collisionModels.clear();
     pSpawnPoints.clear();
     pFaceIDLIST.clear();
 
@@ -443,6 +450,56 @@ void OutdoorLocation::Release() {
     viewparams->location_minimap = nullptr;
 }
 
+void OutdoorLocation::BuildFloorGrid() {
+    // Grid cells are the size of a terrain tile.
+    static constexpr float FLOOR_GRID_CELL_SIZE = 512.0f;
+
+    floorFaces.clear();
+    std::vector<BBoxf> bounds;
+    for (size_t modelIndex = 0; modelIndex < pBModels.size(); modelIndex++) {
+        for (size_t faceIndex = 0; faceIndex < pBModels[modelIndex].pFaces.size(); faceIndex++) {
+            const ODMFace &face = pBModels[modelIndex].pFaces[faceIndex];
+
+            // Note that we don't filter out ethereal faces here as face attributes can be changed by scripts.
+            if (face.uNumVertices == 0)
+                continue;
+
+            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
+                continue;
+
+            floorFaces.push_back({static_cast<int>(modelIndex), static_cast<int>(faceIndex)});
+            bounds.push_back(face.pBoundingBox);
+        }
+    }
+
+    floorGrid.build(bounds, FLOOR_GRID_CELL_SIZE);
+}
+
+void OutdoorLocation::BuildCollisionData() {
+    size_t totalFaces = 0;
+    for (const BSPModel &model : pBModels)
+        totalFaces += model.pFaces.size();
+
+    collisionFaces.clear();
+    collisionFaces.reserve(totalFaces);
+    collisionModels.clear();
+    collisionModels.resize(pBModels.size());
+
+    std::vector<BBoxf> bounds;
+    for (size_t modelIndex = 0; modelIndex < pBModels.size(); modelIndex++) {
+        BSPModel &model = pBModels[modelIndex];
+        ODMCollisionModel &collisionModel = collisionModels[modelIndex];
+
+        collisionModel.firstFace = collisionFaces.size();
+        bounds.clear();
+        for (ODMFace &face : model.pFaces) {
+            collisionFaces.emplace_back().FromODM(&face);
+            bounds.push_back(face.pBoundingBox);
+        }
+        collisionModel.faceTree.build(bounds);
+    }
+}
+
 void OutdoorLocation::Load(std::string_view filename, int days_played, int respawn_interval_days, bool *outdoors_was_respawned) {
     //if (engine->IsUnderwater()) {
     //    pPaletteManager->pPalette_tintColor[0] = 0x10;
@@ -472,6 +529,8 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     OutdoorLocation_MM7 location;
     deserialize(lod::decodeMaybeCompressed(pGames_LOD->read(odm_filename)), &location); // read throws.
     reconstruct(location, this);
+    BuildFloorGrid();
+    BuildCollisionData();
 
     // ****************.ddm file*********************//
 
@@ -480,6 +539,7 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     bool respawnInitial = false; // Perform initial location respawn?
     bool respawnTimed = false; // Perform timed location respawn?
     OutdoorDelta_MM7 delta;
+    FinishPendingSave(ddm_filename);
     if (Blob blob = lod::decodeMaybeCompressed(pSave_LOD->read(ddm_filename))) {
         try {
             deserialize(blob, &delta, tags::context(location));
@@ -819,44 +879,38 @@ float ODM_GetFloorLevel(const Vec3f &pos, bool *pIsOnWater, int *faceId) {
 
     int surface_count = 1;
 
-    for (BSPModel &model : pOutdoor->pBModels) {
+    // Grid candidates are sorted by model & face index, so we visit faces in the same order as a full scan over
+    // all models would.
+    for (int candidate : pOutdoor->floorGrid.candidates(pos.x, pos.y)) {
+        const ODMFaceRef &ref = pOutdoor->floorFaces[candidate];
+        BSPModel &model = pOutdoor->pBModels[ref.modelIndex];
         if (!model.pBoundingBox.containsXY(pos.x, pos.y))
             continue;
 
-        if (model.pFaces.empty())
+        ODMFace &face = model.pFaces[ref.faceIndex];
+        if (face.Ethereal())
             continue;
 
-        for (ODMFace &face : model.pFaces) {
-            if (face.Ethereal())
-                continue;
-
-            if (face.uNumVertices == 0)
-                continue;
-
-            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
-                continue;
-
-            if (!face.pBoundingBox.containsXY(pos.x, pos.y))
-                continue;
-
-            int slack = engine->config->gameplay.FloorChecksEps.value();
-            if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
-                continue;
+        if (!face.pBoundingBox.containsXY(pos.x, pos.y))
+            continue;
 
-            int floor_level;
-            if (face.uPolygonType == POLYGON_Floor) {
-                floor_level = model.pVertices[face.pVertexIDs[0]].z;
-            } else {
-                floor_level = face.zCalc.calculate(pos.x, pos.y);
-            }
-            odm_floor_level[surface_count] = floor_level;
-            current_BModel_id[surface_count] = model.index;
-            current_Face_id[surface_count] = face.index;
-            surface_count++;
+        int slack = engine->config->gameplay.FloorChecksEps.value();
+        if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
+            continue;
 
-            if (surface_count >= 20)
-                break;
+        int floor_level;
+        if (face.uPolygonType == POLYGON_Floor) {
+            floor_level = model.pVertices[face.pVertexIDs[0]].z;
+        } else {
+            floor_level = face.zCalc.calculate(pos.x, pos.y);
         }
+        odm_floor_level[surface_count] = floor_level;
+        current_BModel_id[surface_count] = model.index;
+        current_Face_id[surface_count] = face.index;
+        surface_count++;
+
+        if (surface_count >= 20)
+            break;
     }
 
     if (surface_count == 1) {
@@ -1605,14 +1659,77 @@ void SetUnderwaterFog() {
 }
 
 //----- (004706C6) --------------------------------------------------------
+/**
+ * Results of the read-only per-actor queries that `UpdateActors_ODM` runs on the thread pool before the serial update
+ * pass. Stored as a structure of arrays indexed by actor id, and reused between frames.
+ */
+struct ODMActorQueries {
+    std::vector<uint8_t> valid; // Not using std::vector<bool> as elements are written from different threads.
+    std::vector<Vec3f> pos; // Actor position that the queries were run for.
+    std::vector<float> floorLevel;
+    std::vector<int> floorPid;
+    std::vector<uint8_t> onWater;
+    std::vector<uint8_t> slopeHigh;
+    std::vector<Vec3f> terrainNormal; // Only set if `slopeHigh` is set.
+
+    void resize(size_t size) {
+        valid.assign(size, false);
+        pos.resize(size);
+        floorLevel.resize(size);
+        floorPid.resize(size);
+        onWater.resize(size);
+        slopeHigh.resize(size);
+        terrainNormal.resize(size);
+    }
+};
+
+static ODMActorQueries odmActorQueries;
+
+static bool shouldUpdateActorODM(const Actor &actor) {
+    return actor.aiState != Removed && actor.aiState != Disabled && actor.aiState != Summoned && actor.moveSpeed;
+}
+
+/**
+ * Phase one of `UpdateActors_ODM`. Runs floor, water & slope queries for all actors in parallel. These only depend on
+ * level geometry and actor's own position, so running them upfront produces the same results as running them in the
+ * serial loop.
+ */
+static void runActorQueriesODM() {
+    odmActorQueries.resize(pActors.size());
+    if (!engine->config->debug.ParallelActorQueries.value())
+        return;
+
+    engine->threadPool()->parallelFor(pActors.size(), [](size_t i) {
+        const Actor &actor = pActors[i];
+        if (!shouldUpdateActorODM(actor))
+            return;
+
+        bool onWater = false;
+        int floorPid = 0;
+        odmActorQueries.pos[i] = actor.pos;
+        odmActorQueries.floorLevel[i] = ODM_GetFloorLevel(actor.pos, &onWater, &floorPid);
+        odmActorQueries.floorPid[i] = floorPid;
+        odmActorQueries.onWater[i] = onWater;
+        odmActorQueries.slopeHigh[i] = pOutdoor->pTerrain.isSlopeTooHighByPos(actor.pos);
+        if (odmActorQueries.slopeHigh[i])
+            odmActorQueries.terrainNormal[i] = pOutdoor->pTerrain.normalByPos(actor.pos); // Only depends on x & y.
+        odmActorQueries.valid[i] = true;
+    }, 16);
+}
+
 void UpdateActors_ODM() {
     if (engine->config->debug.NoActors.value())
         return;  // uNumActors = 0;
 
+    runActorQueriesODM();
+
+    // Phase two, apply the updates in actor order.
     for (unsigned int Actor_ITR = 0; Actor_ITR < pActors.size(); ++Actor_ITR) {
-        if (pActors[Actor_ITR].aiState == Removed || pActors[Actor_ITR].aiState == Disabled ||
-            pActors[Actor_ITR].aiState == Summoned || !pActors[Actor_ITR].moveSpeed)
-                continue;
+        if (!shouldUpdateActorODM(pActors[Actor_ITR]))
+            continue;
+
+        // Actor might have been moved by the code that ran after the queries, recalculate in this case.
+        bool haveQueries = odmActorQueries.valid[Actor_ITR] && odmActorQueries.pos[Actor_ITR] == pActors[Actor_ITR].pos;
 
         bool Water_Walk = supertypeForMonsterId(pActors[Actor_ITR].monsterInfo.id) == MONSTER_SUPERTYPE_WATER_ELEMENTAL;
 
@@ -1622,10 +1739,19 @@ void UpdateActors_ODM() {
         if (!pActors[Actor_ITR].CanAct())
             uIsFlying = 0;
 
-        bool Slope_High = pOutdoor->pTerrain.isSlopeTooHighByPos(pActors[Actor_ITR].pos);
+        bool Slope_High;
         int Model_On_PID = 0;
         bool uIsOnWater = false;
-        float Floor_Level = ODM_GetFloorLevel(pActors[Actor_ITR].pos, &uIsOnWater, &Model_On_PID);
+        float Floor_Level;
+        if (haveQueries) {
+            Slope_High = odmActorQueries.slopeHigh[Actor_ITR];
+            Model_On_PID = odmActorQueries.floorPid[Actor_ITR];
+            uIsOnWater = odmActorQueries.onWater[Actor_ITR];
+            Floor_Level = odmActorQueries.floorLevel[Actor_ITR];
+        } else {
+            Slope_High = pOutdoor->pTerrain.isSlopeTooHighByPos(pActors[Actor_ITR].pos);
+            Floor_Level = ODM_GetFloorLevel(pActors[Actor_ITR].pos, &uIsOnWater, &Model_On_PID);
+        }
         bool Actor_On_Terrain = Model_On_PID == 0;
 
         bool uIsAboveFloor = (pActors[Actor_ITR].pos.z > (Floor_Level + 1));
@@ -1684,7 +1810,7 @@ void UpdateActors_ODM() {
         if (!uIsAboveFloor || uIsFlying) {
             if (Slope_High && !uIsAboveFloor && Actor_On_Terrain) {
                 pActors[Actor_ITR].pos.z = Floor_Level;
-                Vec3f Terrain_Norm = pOutdoor->pTerrain.normalByPos(pActors[Actor_ITR].pos);
+                Vec3f Terrain_Norm = haveQueries ? odmActorQueries.terrainNormal[Actor_ITR] : pOutdoor->pTerrain.normalByPos(pActors[Actor_ITR].pos);
                 int Gravity = GetGravityStrength();
 
                 pActors[Actor_ITR].velocity.z += -16 * pEventTimer->dt().ticks() * Gravity; //TODO(pskelton): common gravity code extract
@@ -1795,6 +1921,7 @@ static void loadAndPrepareODMInternal(MapId mapid) {
     }
     day_attrib &= ~MAP_WEATHER_FOGGY;
     pOutdoor->Initialize(mapFilename, pParty->GetPlayingTime().toDays() + 1, respawn_interval, &outdoor_was_respawned);
+    assets->startPrefetch(engine->threadPool());
 
     if (!(dword_6BE364_game_settings_1 & GAME_SETTINGS_LOADING_SAVEGAME_SKIP_RESPAWN)) {
         Actor::InitializeActors();
@@ -1824,6 +1951,9 @@ static void loadAndPrepareODMInternal(MapId mapid) {
     pOutdoor->UpdateSunlightVectors();
 
     MM7Initialization();
+
+    pAudioPlayer->preloadLevelSounds(engine->threadPool());
+    assets->finishPrefetch();
 }
 
 void loadAndPrepareODM(MapId mapid, bool bLoading) {
@@ -8,8 +8,11 @@
 #include "Engine/MapEnums.h"
 
 #include "Library/Color/Color.h"
+#include "Library/Geometry/BBoxTree.h"
+#include "Library/Geometry/SpatialGrid.h"
 
 #include "BSPModel.h"
+#include "Indoor.h"
 #include "LocationInfo.h"
 #include "LocationTime.h"
 #include "LocationFunctions.h"
@@ -21,6 +24,22 @@ struct TileData;
 struct RenderVertexSoft;
 struct ODMRenderParams;
 
+/**
+ * Reference to a face of an outdoor model, used as an entry in `OutdoorLocation::floorFaces`.
+ */
+struct ODMFaceRef {
+    int modelIndex = 0;
+    int faceIndex = 0;
+};
+
+/**
+ * Load-time collision data for an outdoor model, see `OutdoorLocation::BuildCollisionData`.
+ */
+struct ODMCollisionModel {
+    int firstFace = 0; // Index of this model's first face in `OutdoorLocation::collisionFaces`.
+    BBoxTree<float> faceTree; // Tree over the model's face bounds, ids are face indices in `BSPModel::pFaces`.
+};
+
 struct DMap {
     uint8_t field0;
     uint8_t field1;
@@ -36,6 +55,18 @@ struct OutdoorLocation {
     void Release();
     void Load(std::string_view filename, int days_played, int respawn_interval_days, bool *outdoors_was_respawned);
 
+    /**
+     * Rebuilds `floorFaces` & `floorGrid`. Outdoor models never move, so this needs to be called only once per
+     * level load.
+     */
+    void BuildFloorGrid();
+
+    /**
+     * Rebuilds `collisionFaces` & `collisionModels`. Converted faces point into the vertex id arrays of `pBModels`,
+     * so this must be called again if `pBModels` is reallocated.
+     */
+    void BuildCollisionData();
+
     int UpdateDiscoveredArea(Vec2i gridPos);
     bool IsMapCellFullyRevealed(signed int a2, signed int a3);
     bool IsMapCellPartiallyRevealed(signed int a2, signed int a3);
@@ -80,6 +111,10 @@ struct OutdoorLocation {
     std::string sky_texture_filename;
     OutdoorTerrain pTerrain;
     std::vector<BSPModel> pBModels;
+    std::vector<ODMFaceRef> floorFaces; // All floor & in-between faces of all models, in model & face order.
+    SpatialGrid<float> floorGrid; // Broad-phase index over `floorFaces` bounds, used by `ODM_GetFloorLevel`.
+    std::vector<BLVFace> collisionFaces; // All model faces converted with `BLVFace::FromODM`, model after model.
+    std::vector<ODMCollisionModel> collisionModels; // Per-model collision data, indexed by model index.
     std::vector<Pid> pFaceIDLIST;
     std::array<uint32_t, 128 * 128> pOMAP;
     GraphicsImage *sky_texture = nullptr;        // signed int sSky_TextureID;
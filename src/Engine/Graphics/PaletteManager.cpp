@@ -7,6 +7,7 @@
 #include "Engine/Engine.h"
 
 #include "Library/Color/Color.h"
+#include "Library/Color/ColorKernels.h"
 #include "Library/LodFormats/LodImage.h"
 #include "Library/Logger/Logger.h"
 
@@ -50,8 +51,7 @@ Palette PaletteManager::createLoadedPalette(const Palette &palette) {
     float xs = engine->config->graphics.Saturation.value();
     float xv = engine->config->graphics.Lightness.value();
 
-    Palette result;
-    for (size_t i = 0; i < 256; i++)
-        result.colors[i] = palette.colors[i].toHsvColorf().adjusted(0, xs, xv).toColor();
+    Palette result = palette;
+    adjustColors(result.colors, xs, xv);
     return result;
 }
@@ -20,8 +20,7 @@
 SpriteFrameTable *pSpriteFrameTable;
 
 void Sprite::Release() {
-    delete this->sprite_header;
-    this->sprite_header = nullptr;
+    this->lodSprite = LodSpriteView();
     this->texture->release();
     this->texture = nullptr;
     this->pName = "null";
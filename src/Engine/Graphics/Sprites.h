@@ -6,12 +6,13 @@
 
 #include "Engine/Time/Duration.h"
 
+#include "Library/LodFormats/LodSprite.h"
+
 #include "SpriteEnums.h"
 #include "SpriteEnumFunctions.h"
 
 struct DecorationDesc;
 class GraphicsImage;
-struct LodSprite;
 
 class Sprite {
  public:
@@ -23,7 +24,7 @@ class Sprite {
     int uAreaY = 0; // TODO(captainurist): was intended to support sprite maps?
     int uWidth = 0; // Same as texture->width().
     int uHeight = 0;
-    LodSprite *sprite_header = nullptr;
+    LodSpriteView lodSprite; // Indexed pixels, owned by the `LodSpriteCache` this sprite was loaded from.
 };
 
 // TODO(captainurist) : move to Engine/Data and Engine/Tables
@@ -0,0 +1,58 @@
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Data/TileEnumFunctions.h"
+#include "Engine/Graphics/TileCache.h"
+
+static std::vector<RgbaImage> makeTestTiles() {
+    std::vector<RgbaImage> result;
+    for (TileVariant variant : allGeneratedTileVariants()) {
+        int index = std::to_underlying(variant);
+        result.push_back(RgbaImage::solid(Color(index, 255 - index, 7, 255), 4 + index % 3, 4));
+    }
+    return result;
+}
+
+UNIT_TEST(TileCache, RoundTrip) {
+    std::vector<RgbaImage> tiles = makeTestTiles();
+    Blob cache = serializeTileCache(0x1234567890ABCDEF, tiles, "test.bin");
+
+    auto parsed = parseTileCache(cache, 0x1234567890ABCDEF);
+    ASSERT_TRUE(parsed);
+    ASSERT_EQ(parsed->size(), tiles.size());
+
+    const char *begin = static_cast<const char *>(cache.data());
+    const char *end = begin + cache.size();
+    for (size_t i = 0; i < tiles.size(); i++) {
+        auto [variant, image] = (*parsed)[i];
+        EXPECT_EQ(variant, allGeneratedTileVariants()[i]);
+        EXPECT_EQ(image.width(), tiles[i].width());
+        EXPECT_EQ(image.height(), tiles[i].height());
+        EXPECT_EQ(std::memcmp(image.pixels().data(), tiles[i].pixels().data(), tiles[i].pixels().size_bytes()), 0);
+
+        // Tiles are served straight from the cache data.
+        const char *pixels = reinterpret_cast<const char *>(image.pixels().data());
+        EXPECT_TRUE(pixels >= begin && pixels < end);
+    }
+}
+
+UNIT_TEST(TileCache, StaleKey) {
+    Blob cache = serializeTileCache(1, makeTestTiles(), "test.bin");
+    EXPECT_FALSE(parseTileCache(cache, 2));
+    EXPECT_TRUE(parseTileCache(cache, 1));
+}
+
+UNIT_TEST(TileCache, StaleVersion) {
+    Blob cache = serializeTileCache(1, makeTestTiles(), "test.bin");
+
+    // Version immediately follows the magic.
+    const char *begin = static_cast<const char *>(cache.data());
+    std::vector<char> data(begin, begin + cache.size());
+    uint32_t version = TILE_CACHE_VERSION + 1;
+    std::memcpy(data.data() + sizeof(uint32_t), &version, sizeof(version));
+
+    EXPECT_FALSE(parseTileCache(Blob::view(data.data(), data.size()), 1));
+}
@@ -0,0 +1,116 @@
+#include "TileCache.h"
+
+#include <cassert>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#include "Engine/Data/TileEnumFunctions.h"
+
+#include "Library/Binary/BinarySerialization.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/Streams/MemoryInputStream.h"
+
+namespace {
+
+constexpr uint32_t TILE_CACHE_MAGIC = 0x4C544F45; // "EOTL".
+constexpr uint32_t MAX_TILE_SIZE = 1024; // Sanity limit for tile dimensions when loading the cache.
+
+#pragma pack(push, 1)
+
+struct TileCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key; // Hash of the source tiles, see `TileGenerator::tilesetCacheKey`.
+    uint32_t tileCount; // Number of `TileCacheEntry` structs that follow.
+    uint32_t reserved = 0;
+};
+static_assert(sizeof(TileCacheHeader) == 24);
+
+struct TileCacheEntry {
+    uint32_t variant; // `TileVariant`.
+    uint32_t width;
+    uint32_t height;
+    uint32_t offset; // Offset of the RGBA pixel data from the start of the file.
+};
+static_assert(sizeof(TileCacheEntry) == 16);
+
+#pragma pack(pop)
+
+} // namespace
+
+MM_DECLARE_MEMCOPY_SERIALIZABLE(TileCacheHeader)
+MM_DECLARE_MEMCOPY_SERIALIZABLE(TileCacheEntry)
+
+Blob serializeTileCache(uint64_t key, std::span<const RgbaImage> tiles, std::string_view displayPath) {
+    assert(tiles.size() == allGeneratedTileVariants().size());
+
+    Blob result;
+    BlobOutputStream stream(&result, displayPath);
+
+    TileCacheHeader header;
+    header.magic = TILE_CACHE_MAGIC;
+    header.version = TILE_CACHE_VERSION;
+    header.key = key;
+    header.tileCount = tiles.size();
+    serialize(header, &stream);
+
+    size_t offset = sizeof(TileCacheHeader) + tiles.size() * sizeof(TileCacheEntry);
+    for (size_t i = 0; i < tiles.size(); i++) {
+        TileCacheEntry entry;
+        entry.variant = std::to_underlying(allGeneratedTileVariants()[i]);
+        entry.width = tiles[i].width();
+        entry.height = tiles[i].height();
+        entry.offset = offset;
+        serialize(entry, &stream);
+        offset += tiles[i].pixels().size_bytes();
+    }
+
+    for (const RgbaImage &tile : tiles)
+        stream.write(tile.pixels().data(), tile.pixels().size_bytes());
+
+    stream.close();
+    return result;
+}
+
+std::optional<std::vector<std::pair<TileVariant, RgbaImageView>>> parseTileCache(const Blob &cache, uint64_t key) {
+    std::vector<std::pair<TileVariant, RgbaImageView>> result;
+    try {
+        MemoryInputStream stream(cache.data(), cache.size(), cache.displayPath());
+
+        TileCacheHeader header;
+        deserialize(stream, &header);
+        if (header.magic != TILE_CACHE_MAGIC || header.version != TILE_CACHE_VERSION || header.key != key)
+            return std::nullopt; // Stale cache, not an error.
+
+        if (header.tileCount != allGeneratedTileVariants().size()) {
+            logger->warning("Tile cache '{}' is corrupted", cache.displayPath());
+            return std::nullopt;
+        }
+
+        for (size_t i = 0; i < header.tileCount; i++) {
+            TileCacheEntry entry;
+            deserialize(stream, &entry);
+
+            TileVariant variant = static_cast<TileVariant>(entry.variant);
+            size_t size = static_cast<size_t>(entry.width) * entry.height * sizeof(Color);
+            if (variant != allGeneratedTileVariants()[i] || entry.width == 0 || entry.height == 0 ||
+                entry.width > MAX_TILE_SIZE || entry.height > MAX_TILE_SIZE || entry.offset > cache.size() ||
+                size > cache.size() - entry.offset) {
+                logger->warning("Tile cache '{}' is corrupted", cache.displayPath());
+                return std::nullopt;
+            }
+
+            const char *data = static_cast<const char *>(cache.data()) + entry.offset;
+            const Color *pixels = reinterpret_cast<const Color *>(data);
+            result.emplace_back(variant, RgbaImageView(pixels, entry.width, entry.height));
+        }
+    } catch (const std::exception &e) {
+        logger->warning("Could not load tile cache '{}': {}", cache.displayPath(), e.what());
+        return std::nullopt;
+    }
+
+    return result;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Engine/Data/TileEnums.h"
+
+#include "Library/Image/Image.h"
+
+#include "Utility/Memory/Blob.h"
+
+/**
+ * Version of the tile cache format & of the tile generation code. Bump this when either of these changes, stale
+ * cache files will then be regenerated.
+ */
+inline constexpr uint32_t TILE_CACHE_VERSION = 1;
+
+/**
+ * Serializes generated tiles for a single tileset into the raw tile cache format. The format is a header, followed by
+ * a table of tile entries, followed by uncompressed RGBA pixel data for all the tiles.
+ *
+ * @param key                           Hash of the source tiles that were used to generate the tiles.
+ * @param tiles                         Generated tiles, one for each of `allGeneratedTileVariants`, in order.
+ * @param displayPath                   Display path for the resulting blob.
+ * @return                              Serialized tile cache.
+ */
+[[nodiscard]] Blob serializeTileCache(uint64_t key, std::span<const RgbaImage> tiles, std::string_view displayPath);
+
+/**
+ * Parses a tile cache that was produced by `serializeTileCache`.
+ *
+ * @param cache                         Tile cache data.
+ * @param key                           Expected hash of the source tiles.
+ * @return                              Tiles pointing into `cache`, or `std::nullopt` if the cache is stale or
+ *                                      corrupted.
+ */
+[[nodiscard]] std::optional<std::vector<std::pair<TileVariant, RgbaImageView>>> parseTileCache(const Blob &cache,
+                                                                                               uint64_t key);
@@ -1,26 +1,41 @@
 #include "TileGenerator.h"
 
 #include <cassert>
+#include <algorithm>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "Engine/AssetsManager.h"
+#include "Engine/Engine.h"
 #include "Engine/Resources/EngineFileSystem.h"
 #include "Engine/Resources/LodTextureCache.h"
 #include "Engine/Data/TileEnumFunctions.h"
 #include "Engine/Tables/TileTable.h"
 #include "Engine/Graphics/Image.h"
+#include "Engine/Graphics/TileCache.h"
 #include "Library/Image/ImageFunctions.h"
-#include "Library/Image/Png.h"
 #include "Library/LodFormats/LodFormats.h"
 #include "Library/LodFormats/LodImage.h"
 #include "Library/Logger/Logger.h"
 
 #include "Library/Serialization/Serialization.h"
 
+#include "Utility/Concurrency/ThreadPool.h"
+#include "Utility/Exception.h"
 #include "Utility/MapAccess.h"
 
 TileGenerator *pTileGenerator = nullptr;
 
+namespace {
+
+std::string tileCachePath(Tileset tileset) {
+    return fmt::format("generated/tiles/{}.bin", toString(tileset));
+}
+
+} // namespace
+
 TileGenerator::TileGenerator() {
     for (TileVariant variant : allTransitionTileVariants())
         if (!allGeneratedTileVariants().contains(variant))
@@ -43,42 +58,138 @@ void TileGenerator::fillTable() {
             _tilesetVariantByName.emplace(tileData.name, std::pair(tileset, variant));
             pTileTable->addTile(std::move(tileData));
         }
+
+        _tilesets.push_back(tileset);
     }
 }
 
-void TileGenerator::ensureTile(std::string_view name) {
+RgbaImageView TileGenerator::tile(std::string_view name) {
     assert(_tilesetVariantByName.contains(name));
 
-    if (ufs->exists(name))
+    if (!_tilesLoaded)
+        loadTiles();
+
+    return valueOr(_generatedTileByTilesetVariant, *valuePtr(_tilesetVariantByName, name));
+}
+
+void TileGenerator::loadTiles() {
+    assert(!_tilesLoaded);
+
+    // A previous call might have thrown midway. No tiles were handed out in this case, so we can start from scratch.
+    _tileCaches.clear();
+    _generatedTileByTilesetVariant.clear();
+
+    std::vector<Tileset> missingTilesets;
+    std::vector<uint64_t> missingKeys;
+    for (Tileset tileset : _tilesets) {
+        uint64_t key = tilesetCacheKey(tileset);
+        std::string path = tileCachePath(tileset);
+        if (ufs->exists(path) && parseTileset(tileset, key, ufs->read(path)))
+            continue;
+
+        missingTilesets.push_back(tileset);
+        missingKeys.push_back(key);
+    }
+
+    if (missingTilesets.empty()) {
+        _tilesLoaded = true;
         return;
+    }
+
+    // Source tiles are loaded upfront, `loadTile` is not thread-safe.
+    for (Tileset tileset : missingTilesets) {
+        logger->info("Generating tiles for tileset {}.", toString(tileset));
+        for (auto [sourceTileset, sourceVariant] : sourceTiles(tileset))
+            loadTile(sourceTileset, sourceVariant);
+    }
+
+    std::vector<Blob> caches(missingTilesets.size());
+    engine->threadPool()->parallelFor(missingTilesets.size(), [&](size_t i) {
+        caches[i] = generateTileset(missingTilesets[i], missingKeys[i]);
+    });
+    _tileByTilesetVariant.clear();
 
-    auto [tileset, variant] = *valuePtr(_tilesetVariantByName, name);
-    ufs->write(name, png::encode(generateTile(tileset, variant)));
+    for (size_t i = 0; i < missingTilesets.size(); i++) {
+        ufs->write(tileCachePath(missingTilesets[i]), caches[i]);
+        if (!parseTileset(missingTilesets[i], missingKeys[i], std::move(caches[i])))
+            throw Exception("Could not parse generated tiles for tileset {}", toString(missingTilesets[i]));
+    }
+
+    _tilesLoaded = true;
 }
 
-RgbaImage TileGenerator::generateTile(Tileset tileset, TileVariant variant) {
+std::vector<TileVariant> TileGenerator::tileLayers(TileVariant variant) const {
     assert(allGeneratedTileVariants().contains(variant));
 
-    logger->info("Generating tile {}_{}.", toString(tileset), toString(variant));
-
+    std::vector<TileVariant> result;
     Directions currentDirections = 0;
     Directions targetDirections = transitionDirectionsForTileVariant(variant);
+    while (currentDirections != targetDirections) {
+        TileVariant spanningVariant = findSpanningVariant(currentDirections, targetDirections);
+        result.push_back(spanningVariant);
+        currentDirections |= transitionDirectionsForTileVariant(spanningVariant);
+    }
+    return result;
+}
+
+std::vector<std::pair<Tileset, TileVariant>> TileGenerator::sourceTiles(Tileset tileset) const {
+    std::vector<std::pair<Tileset, TileVariant>> result;
+    result.emplace_back(tileset, TILE_VARIANT_BASE1);
+    result.emplace_back(TILESET_DIRT, TILE_VARIANT_BASE1);
+    for (TileVariant variant : allGeneratedTileVariants())
+        for (TileVariant layer : tileLayers(variant))
+            result.emplace_back(tileset, layer);
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+uint64_t TileGenerator::tilesetCacheKey(Tileset tileset) const {
+    Fnv1aHasher hasher;
+    hasher.add(TILE_CACHE_VERSION);
+    for (auto [sourceTileset, sourceVariant] : sourceTiles(tileset)) {
+        const std::string &name = pTileTable->tile(pTileTable->tileId(sourceTileset, sourceVariant)).name;
+        hasher.add(name);
+        hasher.add(pBitmaps_LOD->read(name).string_view());
+    }
+    return hasher.hash();
+}
+
+Blob TileGenerator::generateTileset(Tileset tileset, uint64_t key) const {
+    std::vector<RgbaImage> tiles;
+    for (TileVariant variant : allGeneratedTileVariants())
+        tiles.push_back(generateTile(tileset, variant));
+
+    return serializeTileCache(key, tiles, tileCachePath(tileset));
+}
+
+bool TileGenerator::parseTileset(Tileset tileset, uint64_t key, Blob cache) {
+    std::optional<std::vector<std::pair<TileVariant, RgbaImageView>>> tiles = parseTileCache(cache, key);
+    if (!tiles)
+        return false;
+
+    for (auto [variant, image] : *tiles)
+        _generatedTileByTilesetVariant.insert_or_assign(std::pair(tileset, variant), image);
+    _tileCaches.push_back(std::move(cache)); // Moving a blob doesn't move the underlying data, so views stay valid.
+    return true;
+}
+
+RgbaImage TileGenerator::generateTile(Tileset tileset, TileVariant variant) const {
+    assert(allGeneratedTileVariants().contains(variant));
 
-    RgbaImageView base = loadTile(tileset, TILE_VARIANT_BASE1);
-    RgbaImageView dirt = loadTile(TILESET_DIRT, TILE_VARIANT_BASE1);
+    RgbaImageView base = sourceTile(tileset, TILE_VARIANT_BASE1);
+    RgbaImageView dirt = sourceTile(TILESET_DIRT, TILE_VARIANT_BASE1);
     RgbaImage result;
 
-    while (currentDirections != targetDirections) {
-        TileVariant spanningVariant = findSpanningVariant(currentDirections, targetDirections);
-        RgbaImageView layer = loadTile(tileset, spanningVariant);
+    for (TileVariant layerVariant : tileLayers(variant)) {
+        RgbaImageView layer = sourceTile(tileset, layerVariant);
 
         if (!result) {
             result = RgbaImage::copy(layer.pixels().data(), layer.width(), layer.height());
         } else {
             blendTile(base, dirt, layer, &result);
         }
-
-        currentDirections |= transitionDirectionsForTileVariant(spanningVariant);
     }
 
     return result;
@@ -94,6 +205,12 @@ RgbaImageView TileGenerator::loadTile(Tileset tileset, TileVariant variant) {
     return _tileByTilesetVariant.emplace(key, makeRgbaImage(image.image, image.palette)).first->second;
 }
 
+RgbaImageView TileGenerator::sourceTile(Tileset tileset, TileVariant variant) const {
+    const RgbaImage *result = valuePtr(_tileByTilesetVariant, std::pair(tileset, variant));
+    assert(result); // Must have been loaded with `loadTile`.
+    return *result;
+}
+
 TileVariant TileGenerator::findSpanningVariant(Directions currentDirections, Directions targetDirections) const {
     TileVariant result = TILE_VARIANT_INVALID;
     int maxPopCount = 0;
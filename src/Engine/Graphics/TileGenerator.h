@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 #include <utility>
@@ -9,6 +10,7 @@
 
 #include "Library/Image/Image.h"
 
+#include "Utility/Memory/Blob.h"
 #include "Utility/Hash.h"
 #include "Utility/String/TransparentFunctors.h"
 
@@ -17,6 +19,9 @@ class TileTable;
 /**
  * This class populates the tile table and generates tiles for tile transitions that were missing in MM7 data.
  *
+ * Generated tiles are stored in raw per-tileset cache files in `generated/tiles`, keyed by a hash of the source tiles.
+ * Cache files are memory-mapped on load, and tiles are served directly from the mapped data w/o any decoding.
+ *
  * Actual terrain patching to use the new tiles is done in `OutdoorTerrain::recalculateTransitions`.
  */
 class TileGenerator {
@@ -25,19 +30,30 @@ class TileGenerator {
     ~TileGenerator();
 
     /**
-     * Fills the tile table with the new tiles. Be sure to call `ensureTile` for each of the tiles you'll actually use.
+     * Fills the tile table with the new tiles. Tile images are then available through `tile`.
      */
     void fillTable();
 
     /**
-     * @param name                      Name of the tile to generate if it doesn't exist yet. Name must come from
-     *                                  what was generated by a call to `fillTable`.
+     * Returns a generated tile. On the first call all of the generated tiles are loaded from the cache, and the
+     * tilesets that are missing from the cache or have stale cache entries are generated in parallel on the engine's
+     * thread pool.
+     *
+     * @param name                      Name of the tile, must come from what was generated by a call to `fillTable`.
+     * @return                          Generated tile. The view stays valid for the lifetime of this object.
      */
-    void ensureTile(std::string_view name);
+    RgbaImageView tile(std::string_view name);
 
  private:
-    RgbaImage generateTile(Tileset tileset, TileVariant variant);
+    void loadTiles();
+    [[nodiscard]] std::vector<TileVariant> tileLayers(TileVariant variant) const;
+    [[nodiscard]] std::vector<std::pair<Tileset, TileVariant>> sourceTiles(Tileset tileset) const;
+    [[nodiscard]] uint64_t tilesetCacheKey(Tileset tileset) const;
+    [[nodiscard]] Blob generateTileset(Tileset tileset, uint64_t key) const;
+    [[nodiscard]] bool parseTileset(Tileset tileset, uint64_t key, Blob cache);
+    [[nodiscard]] RgbaImage generateTile(Tileset tileset, TileVariant variant) const;
     RgbaImageView loadTile(Tileset tileset, TileVariant variant);
+    [[nodiscard]] RgbaImageView sourceTile(Tileset tileset, TileVariant variant) const;
     TileVariant findSpanningVariant(Directions currentDirections, Directions targetDirections) const;
     void blendTile(RgbaImageView base, RgbaImageView dirt, RgbaImageView layer1, RgbaImage *layer0) const;
 
@@ -45,10 +61,22 @@ class TileGenerator {
     /** All standard transition tiles & their directions. */
     std::vector<std::pair<TileVariant, Directions>> _standardTiles;
 
+    /** Tilesets that have generated tiles, filled in `fillTable`. */
+    std::vector<Tileset> _tilesets;
+
     /** Cached images for standard transition tiles. We can't use images from `AssetsManager` because they are
-     * desaturation-adjusted. */
+     * desaturation-adjusted. Only used during generation, cleared afterwards. */
     std::unordered_map<std::pair<Tileset, TileVariant>, RgbaImage> _tileByTilesetVariant;
 
+    /** Whether `loadTiles` has finished successfully. */
+    bool _tilesLoaded = false;
+
+    /** Per-tileset tile caches, either memory-mapped, or freshly generated. */
+    std::vector<Blob> _tileCaches;
+
+    /** Generated tiles, pointing into `_tileCaches`. */
+    std::unordered_map<std::pair<Tileset, TileVariant>, RgbaImageView> _generatedTileByTilesetVariant;
+
     /** Name to tileset-variant mapping. Used for figuring out at runtime which tile is requested w/o having to parse
      * the name. */
     std::unordered_map<std::string, std::pair<Tileset, TileVariant>, TransparentStringHash, TransparentStringEquals> _tilesetVariantByName;
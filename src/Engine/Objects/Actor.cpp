@@ -12,6 +12,7 @@
 #include "Engine/Data/HouseEnumFunctions.h"
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/DecalBuilder.h"
+#include "Engine/Objects/ActorGrid.h"
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
@@ -51,6 +52,9 @@ static SpellFxRenderer *spell_fx_renderer = EngineIocContainer::ResolveSpellFxRe
 // Using deque for pointer stability
 std::deque<Actor> pActors;
 
+// Spatial index over pActors used when building the AI lists, synced every frame in collectActorsInRange.
+static ActorGrid actorGrid;
+
 stru319 stru_50C198;  // idb
 
 static constexpr IndexedArray<int, HOSTILITY_FIRST, HOSTILITY_LAST> _4DF380_hostilityRanges = {
@@ -3857,17 +3861,26 @@ void toggleActorGroupFlag(unsigned int uGroupID, ActorAttribute uFlag,
 }
 
 //----- (004014E6) --------------------------------------------------------
-void Actor::MakeActorAIList_ODM() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
-
-    pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
-
-    for (Actor &actor : pActors) {
-        actor.ResetFullAiState();
-        if (!actor.CanAct()) {
-            actor.ResetActive();
-            continue;
-        }
+/**
+ * Collects the actors that are within `range` of the party into `activeActorsDistances`, sorted by distance. Only the
+ * actors from the nearby grid cells are checked. Also marks the collected actors in `inRange`.
+ *
+ * Note that the result is sorted by (distance, id), which is the same order the original full scan with a stable sort
+ * produced.
+ */
+static void collectActorsInRange(int range, std::vector<std::pair<int, int>> *activeActorsDistances,
+                                 std::vector<bool> *inRange) {
+    actorGrid.update();
+
+    activeActorsDistances->clear();
+    inRange->assign(pActors.size(), false);
+
+    // int_get_vector_length never returns less than the max coordinate delta, so we can look up a square.
+    float halfSide = range + actorGrid.maxRadius() + 1;
+    actorGrid.forEachNear(pParty->pos, halfSide, [&](int id) {
+        Actor &actor = pActors[id];
+        if (!actor.CanAct())
+            return;
 
         int delta_x = std::abs(pParty->pos.x - actor.pos.x);
         int delta_y = std::abs(pParty->pos.y - actor.pos.y);
@@ -3877,25 +3890,44 @@ void Actor::MakeActorAIList_ODM() {
         if (distance < 0)
             distance = 0;
 
-        if (distance < 5632) {
-            actor.ResetHostile();
-            if (actor.ActorEnemy() || actor.GetActorsRelation(0) != HOSTILITY_FRIENDLY) {
-                actor.attributes |= ACTOR_HOSTILE;
-                if (distance < 5120)
-                    pParty->SetYellowAlert();
-                if (distance < 307)
-                    pParty->SetRedAlert();
-            }
-            actor.attributes |= ACTOR_ACTIVE;
-            activeActorsDistances.push_back({actor.id, distance});
-        } else {
-            actor.ResetActive();
+        if (distance < range) {
+            activeActorsDistances->push_back({id, distance});
+            (*inRange)[id] = true;
         }
+    });
+
+    std::ranges::sort(*activeActorsDistances, [] (std::pair<int, int> a, std::pair<int, int> b) {
+        return a.second < b.second || (a.second == b.second && a.first < b.first);
+    });
+
+    // Actors that are out of range or can't act are idle.
+    for (Actor &actor : pActors) {
+        actor.ResetFullAiState();
+        if (!(*inRange)[actor.id])
+            actor.ResetActive();
     }
+}
+
+void Actor::MakeActorAIList_ODM() {
+    static std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>, reused between calls.
+    static std::vector<bool> inRange;
+
+    pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
 
-    // sort active actors by distance
-    // use stable_sort to make tests work across all platforms
-    std::stable_sort(activeActorsDistances.begin(), activeActorsDistances.end(), [] (std::pair<int, int> a, std::pair<int, int> b) { return a.second < b.second; });
+    collectActorsInRange(5632, &activeActorsDistances, &inRange);
+
+    for (const auto &[actorId, distance] : activeActorsDistances) {
+        Actor &actor = pActors[actorId];
+        actor.ResetHostile();
+        if (actor.ActorEnemy() || actor.GetActorsRelation(0) != HOSTILITY_FRIENDLY) {
+            actor.attributes |= ACTOR_HOSTILE;
+            if (distance < 5120)
+                pParty->SetYellowAlert();
+            if (distance < 307)
+                pParty->SetRedAlert();
+        }
+        actor.attributes |= ACTOR_ACTIVE;
+    }
 
     // and takes nearest amount
     int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
@@ -3909,54 +3941,38 @@ void Actor::MakeActorAIList_ODM() {
 
 //----- (004016FA) --------------------------------------------------------
 int Actor::MakeActorAIList_BLV() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
-    std::vector<int> pickedActorIds;
+    static std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>, reused between calls.
+    static std::vector<bool> inRange;
+    static std::vector<int> pickedActorIds;
+    static std::vector<bool> picked;
 
     // reset party alert level
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
 
     // find actors that are in range and can act
-    for (Actor &actor : pActors) {
-        actor.ResetFullAiState();
-        if (!actor.CanAct()) {
-            actor.ResetActive();
-            continue;
-        }
-
-        int delta_x = std::abs(pParty->pos.x - actor.pos.x);
-        int delta_y = std::abs(pParty->pos.y - actor.pos.y);
-        int delta_z = std::abs(pParty->pos.z - actor.pos.z);
-
-        int distance = int_get_vector_length(delta_x, delta_y, delta_z) - actor.radius;
-        if (distance < 0)
-            distance = 0;
-
-        // actor is in range
-        if (distance < 10240) {
-            actor.ResetHostile();
-            if (actor.ActorEnemy() || actor.GetActorsRelation(0) != HOSTILITY_FRIENDLY) {
-                actor.attributes |= ACTOR_HOSTILE;
-                if (!(pParty->GetRedAlert()) && (double)distance < meleeRange)
-                    pParty->SetRedAlert();
-                if (!(pParty->GetYellowAlert()) && distance < 5120)
-                    pParty->SetYellowAlert();
-            }
-            activeActorsDistances.push_back({actor.id, distance});
-        } else {
-            // otherwise idle
-            actor.ResetActive();
+    collectActorsInRange(10240, &activeActorsDistances, &inRange);
+
+    for (const auto &[actorId, distance] : activeActorsDistances) {
+        Actor &actor = pActors[actorId];
+        actor.ResetHostile();
+        if (actor.ActorEnemy() || actor.GetActorsRelation(0) != HOSTILITY_FRIENDLY) {
+            actor.attributes |= ACTOR_HOSTILE;
+            if (!(pParty->GetRedAlert()) && (double)distance < meleeRange)
+                pParty->SetRedAlert();
+            if (!(pParty->GetYellowAlert()) && distance < 5120)
+                pParty->SetYellowAlert();
         }
     }
 
-    // sort active actors by distance
-    // use stable_sort to make tests work across all platforms
-    std::stable_sort(activeActorsDistances.begin(), activeActorsDistances.end(), [] (std::pair<int, int> a, std::pair<int, int> b) { return a.second < b.second; });
+    pickedActorIds.clear();
+    picked.assign(pActors.size(), false);
 
     // checks nearby actors can detect player and take nearest 30
     for (const auto &[actorId, _] : activeActorsDistances) {
         if (pActors[actorId].ActorNearby() || Detect_Between_Objects(Pid(OBJECT_Actor, actorId), Pid(OBJECT_Character, 0))) {
             pActors[actorId].attributes |= ACTOR_NEARBY;
             pickedActorIds.push_back(actorId);
+            picked[actorId] = true;
             if (pickedActorIds.size() >= 30) {
                 break;
             }
@@ -3965,23 +3981,19 @@ int Actor::MakeActorAIList_BLV() {
 
     // add any actors than can act and are in the same sector
     for (int i = 0; i < pActors.size(); ++i) {
-        if (pActors[i].CanAct() && pActors[i].sectorId == pBLVRenderParams->uPartySectorID) {
-            auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&] (int id) { return id == i; });
-            if (found == pickedActorIds.end()) {
-                pActors[i].attributes |= ACTOR_ACTIVE;
-                pickedActorIds.push_back(i);
-            }
+        if (!picked[i] && pActors[i].sectorId == pBLVRenderParams->uPartySectorID && pActors[i].CanAct()) {
+            pActors[i].attributes |= ACTOR_ACTIVE;
+            pickedActorIds.push_back(i);
+            picked[i] = true;
         }
     }
 
     // add any actors that are active and have previosuly detected the player
     for (const auto &[actorId, _] : activeActorsDistances) {
-        if (pActors[actorId].attributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[actorId].CanAct()) {
-            auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&actorId = actorId] (int id) { return id == actorId; });
-            if (found == pickedActorIds.end()) {
-                pActors[actorId].attributes |= ACTOR_ACTIVE;
-                pickedActorIds.push_back(actorId);
-            }
+        if (!picked[actorId] && pActors[actorId].attributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[actorId].CanAct()) {
+            pActors[actorId].attributes |= ACTOR_ACTIVE;
+            pickedActorIds.push_back(actorId);
+            picked[actorId] = true;
         }
     }
 
@@ -3997,56 +4009,16 @@ int Actor::MakeActorAIList_BLV() {
     return ai_arrays_size;
 }
 
-//----- (004070EF) --------------------------------------------------------
-bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
-    // get object 1 info
-    int obj1_pid = uObjID.id();
-    int obj1_sector;
-    Vec3f pos1;
-
-    switch (uObjID.type()) {
-        case OBJECT_Decoration:
-            pos1 = pLevelDecorations[obj1_pid].vPosition;
-            obj1_sector = pIndoor->GetSector(pos1);
-            break;
-        case OBJECT_Actor:
-            pos1 = pActors[obj1_pid].pos + Vec3f(0, 0, pActors[obj1_pid].height * 0.69999999);
-            obj1_sector = pActors[obj1_pid].sectorId;
-            break;
-        case OBJECT_Sprite:
-            pos1 = pSpriteObjects[obj1_pid].vPosition;
-            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
-    // get object 2 info
-    int obj2_pid = uObj2ID.id();
-    int obj2_sector;
-    Vec3f pos2;
-
-    switch (uObj2ID.type()) {
-        case OBJECT_Decoration:
-            pos2 = pLevelDecorations[obj2_pid].vPosition;
-            obj2_sector = pIndoor->GetSector(pos2);
-            break;
-        case OBJECT_Character:
-            pos2 = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
-            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
-            break;
-        case OBJECT_Actor:
-            pos2 = pActors[obj2_pid].pos + Vec3f(0, 0, pActors[obj2_pid].height * 0.69999999);
-            obj2_sector = pActors[obj2_pid].sectorId;
-            break;
-        case OBJECT_Sprite:
-            pos2 = pSpriteObjects[obj2_pid].vPosition;
-            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
+/**
+ * Line of sight check between two points, walking the portals from `sector1` towards `sector2` indoors.
+ *
+ * @param pos1                          First point.
+ * @param obj1_sector                   Sector of the first point.
+ * @param pos2                          Second point.
+ * @param obj2_sector                   Sector of the second point.
+ * @return                              Whether the points can see each other.
+ */
+static bool detectBetweenPoints(const Vec3f &pos1, int obj1_sector, const Vec3f &pos2, int obj2_sector) {
     // get distance between objects
     float dist_x = pos2.x - pos1.x;
     float dist_y = pos2.y - pos1.y;
@@ -4061,6 +4033,9 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
     // monster in same sector with player/ monster
     if (obj1_sector == obj2_sector) return 1;
 
+    // can't see through the portals if the sector is not even reachable through them
+    if (!pIndoor->IsSectorPotentiallyVisible(obj1_sector, obj2_sector)) return 0;
+
     // normalising
     float rayxnorm = dist_x / dist_3d;
     float rayynorm = dist_y / dist_3d;
@@ -4142,7 +4117,7 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
 
             // did we hit limit for portals?
             // does the next room have portals?
-            if (sectors_visited < 30 && pIndoor->pSectors[current_sector].uNumPortals > 0) {
+            if (sectors_visited < IndoorLocation::MAX_PVS_PORTAL_HOPS && pIndoor->pSectors[current_sector].uNumPortals > 0) {
                 current_portal = -1;
                 continue;
             } else {
@@ -4155,6 +4130,82 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
     return 1;
 }
 
+//----- (004070EF) --------------------------------------------------------
+bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
+    // Detection results are cached per object pair, and are reused only if positions & sectors haven't changed. This
+    // also lets us skip the GetSector calls for decorations, which never move.
+    uint32_t cacheKey = (static_cast<uint32_t>(uObjID.packed()) << 16) | uObj2ID.packed();
+    BLVDetectionCacheEntry *cached = nullptr;
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        auto pos = pIndoor->detectionCache.find(cacheKey);
+        if (pos != pIndoor->detectionCache.end())
+            cached = &pos->second;
+    }
+
+    // get object 1 info
+    int obj1_pid = uObjID.id();
+    int obj1_sector;
+    Vec3f pos1;
+
+    switch (uObjID.type()) {
+        case OBJECT_Decoration:
+            pos1 = pLevelDecorations[obj1_pid].vPosition;
+            obj1_sector = cached && cached->pos1 == pos1 ? cached->sector1 : pIndoor->GetSector(pos1);
+            break;
+        case OBJECT_Actor:
+            pos1 = pActors[obj1_pid].pos + Vec3f(0, 0, pActors[obj1_pid].height * 0.69999999);
+            obj1_sector = pActors[obj1_pid].sectorId;
+            break;
+        case OBJECT_Sprite:
+            pos1 = pSpriteObjects[obj1_pid].vPosition;
+            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    // get object 2 info
+    int obj2_pid = uObj2ID.id();
+    int obj2_sector;
+    Vec3f pos2;
+
+    switch (uObj2ID.type()) {
+        case OBJECT_Decoration:
+            pos2 = pLevelDecorations[obj2_pid].vPosition;
+            obj2_sector = cached && cached->pos2 == pos2 ? cached->sector2 : pIndoor->GetSector(pos2);
+            break;
+        case OBJECT_Character:
+            pos2 = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
+            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
+            break;
+        case OBJECT_Actor:
+            pos2 = pActors[obj2_pid].pos + Vec3f(0, 0, pActors[obj2_pid].height * 0.69999999);
+            obj2_sector = pActors[obj2_pid].sectorId;
+            break;
+        case OBJECT_Sprite:
+            pos2 = pSpriteObjects[obj2_pid].vPosition;
+            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    if (uCurrentlyLoadedLevelType != LEVEL_INDOOR)
+        return detectBetweenPoints(pos1, obj1_sector, pos2, obj2_sector);
+
+    if (cached && cached->pos1 == pos1 && cached->pos2 == pos2 && cached->sector1 == obj1_sector &&
+        cached->sector2 == obj2_sector)
+        return cached->detected;
+
+    BLVDetectionCacheEntry &entry = cached ? *cached : pIndoor->detectionCache[cacheKey];
+    entry.pos1 = pos1;
+    entry.pos2 = pos2;
+    entry.sector1 = obj1_sector;
+    entry.sector2 = obj2_sector;
+    entry.detected = detectBetweenPoints(pos1, obj1_sector, pos2, obj2_sector);
+    return entry.detected;
+}
+
 //----- (0044FA4C) --------------------------------------------------------
 void Spawn_Light_Elemental(int spell_power, Mastery caster_skill_mastery, Duration duration) {
     // size_t uActorIndex;            // [sp+10h] [bp-10h]@6
@@ -0,0 +1,69 @@
+#include "ActorGrid.h"
+
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Objects/Actor.h"
+
+void ActorGrid::update() {
+    while (_cellById.size() > pActors.size()) {
+        remove(_cellById.size() - 1);
+        _cellById.pop_back();
+        _slotById.pop_back();
+    }
+
+    _maxRadius = 0;
+    for (size_t id = 0; id < _cellById.size(); id++) {
+        _maxRadius = std::max<int>(_maxRadius, pActors[id].radius);
+        int cell = cellIndex(pActors[id].pos);
+        if (cell != _cellById[id]) {
+            remove(id);
+            insert(id, cell);
+        }
+    }
+
+    while (_cellById.size() < pActors.size()) {
+        int id = _cellById.size();
+        _cellById.push_back(-1);
+        _slotById.push_back(-1);
+        _maxRadius = std::max<int>(_maxRadius, pActors[id].radius);
+        insert(id, cellIndex(pActors[id].pos));
+    }
+}
+
+int ActorGrid::cellCoord(float coord) {
+    float cell = std::floor(coord / CELL_SIZE) + GRID_SIZE / 2;
+    if (!(cell >= 0)) // Also catches NaNs.
+        return 0;
+    return static_cast<int>(std::min(cell, static_cast<float>(GRID_SIZE - 1)));
+}
+
+int ActorGrid::cellIndex(const Vec3f &pos) {
+    return cellCoord(pos.y) * GRID_SIZE + cellCoord(pos.x);
+}
+
+void ActorGrid::insert(int id, int cell) {
+    assert(_cellById[id] == -1);
+
+    _cellById[id] = cell;
+    _slotById[id] = _cells[cell].size();
+    _cells[cell].push_back(id);
+}
+
+void ActorGrid::remove(int id) {
+    int cell = _cellById[id];
+    if (cell == -1)
+        return;
+
+    // Swap with the last element & pop.
+    std::vector<int> &bucket = _cells[cell];
+    int slot = _slotById[id];
+    int lastId = bucket.back();
+    bucket[slot] = lastId;
+    _slotById[lastId] = slot;
+    bucket.pop_back();
+
+    _cellById[id] = -1;
+    _slotById[id] = -1;
+}
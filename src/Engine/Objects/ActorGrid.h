@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Library/Geometry/Vec.h"
+
+/**
+ * Uniform XY grid of actor ids, used to find the actors near a point without running distance checks for all of
+ * `pActors`.
+ *
+ * The grid is synchronized with `pActors` by calling `update`. This is cheap - it only compares cached cell indices,
+ * and touches the buckets only for the actors that crossed a cell boundary since the last call. Buckets keep their
+ * capacity, so after a few frames the grid doesn't allocate at all.
+ */
+class ActorGrid {
+ public:
+    /**
+     * Synchronizes the grid with `pActors`. Handles moved, added and removed actors.
+     */
+    void update();
+
+    /**
+     * @return                          Max radius of all actors, as of the last call to `update`.
+     */
+    [[nodiscard]] int maxRadius() const {
+        return _maxRadius;
+    }
+
+    /**
+     * Calls the provided callback for ids of all actors whose XY position might lie inside the provided square. Some
+     * of the reported actors might lie outside, callers are expected to perform the exact checks. Ids are reported in
+     * unspecified order.
+     *
+     * @param center                    Square center.
+     * @param halfSide                  Half the side of the square.
+     * @param callback                  Callback to invoke, takes a single `int` argument.
+     */
+    template<class Callback>
+    void forEachNear(const Vec3f &center, float halfSide, Callback &&callback) const {
+        int x1 = cellCoord(center.x - halfSide);
+        int x2 = cellCoord(center.x + halfSide);
+        int y1 = cellCoord(center.y - halfSide);
+        int y2 = cellCoord(center.y + halfSide);
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+                for (int id : _cells[y * GRID_SIZE + x])
+                    callback(id);
+    }
+
+ private:
+    static constexpr int CELL_SIZE = 2048;
+    static constexpr int GRID_SIZE = 64; // Covers [-65536, 65536), positions outside are clamped to the border cells.
+
+    [[nodiscard]] static int cellCoord(float coord);
+    [[nodiscard]] static int cellIndex(const Vec3f &pos);
+
+    void insert(int id, int cell);
+    void remove(int id);
+
+ private:
+    std::array<std::vector<int>, GRID_SIZE * GRID_SIZE> _cells;
+    std::vector<int> _cellById; // Cell index for each actor id.
+    std::vector<int> _slotById; // Index in `_cells[_cellById[id]]` for each actor id.
+    int _maxRadius = 0;
+};
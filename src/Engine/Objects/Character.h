@@ -57,6 +57,7 @@ struct LloydBeacon {
     uint16_t unknown = 0;
     MapId mapId = MAP_INVALID;
     GraphicsImage *image = nullptr;
+    bool imageSaved = false; // Whether `image` is stored as is in `pSave_LOD`, and thus doesn't need to be re-encoded.
 };
 
 // HP/SP regeneration from items and spell
@@ -0,0 +1,85 @@
+#include "AssetCache.h"
+
+#include <cassert>
+#include <algorithm>
+#include <vector>
+
+AssetCache *assetCache = new AssetCache();
+
+CachedAsset::~CachedAsset() {
+    if (_cache)
+        _cache->remove(this);
+}
+
+void CachedAsset::setCachedBytes(size_t bytes) {
+    if (_cache)
+        _cache->updateBytes(this, bytes);
+    _bytes = bytes;
+}
+
+AssetCache::AssetCache() = default;
+
+AssetCache::~AssetCache() {
+    for (CachedAsset *asset : _assets)
+        asset->_cache = nullptr;
+}
+
+void AssetCache::setBudget(size_t budget) {
+    _budget = budget;
+}
+
+void AssetCache::insert(CachedAsset *asset) {
+    assert(asset && !asset->_cache);
+
+    asset->_cache = this;
+    asset->_index = _assets.size();
+    asset->_lastUseFrame = _frame;
+    _assets.push_back(asset);
+
+    _stats.assets = _assets.size();
+    _stats.bytes += asset->_bytes;
+    _stats.peakBytes = std::max(_stats.peakBytes, _stats.bytes);
+}
+
+void AssetCache::remove(CachedAsset *asset) {
+    assert(asset && asset->_cache == this && _assets[asset->_index] == asset);
+
+    updateBytes(asset, 0);
+    _assets[asset->_index] = _assets.back();
+    _assets[asset->_index]->_index = asset->_index;
+    _assets.pop_back();
+    asset->_cache = nullptr;
+
+    _stats.assets = _assets.size();
+}
+
+void AssetCache::updateBytes(CachedAsset *asset, size_t bytes) {
+    _stats.bytes = _stats.bytes - asset->_bytes + bytes;
+    _stats.peakBytes = std::max(_stats.peakBytes, _stats.bytes);
+}
+
+void AssetCache::endFrame() {
+    _frame++;
+
+    if (_budget == 0 || _stats.bytes <= _budget)
+        return;
+
+    std::vector<CachedAsset *> candidates;
+    for (CachedAsset *asset : _assets)
+        if (asset->_bytes > 0 && asset->_lastUseFrame + MIN_IDLE_FRAMES < _frame)
+            candidates.push_back(asset);
+
+    std::sort(candidates.begin(), candidates.end(), [](CachedAsset *l, CachedAsset *r) {
+        return l->_lastUseFrame < r->_lastUseFrame;
+    });
+
+    // Evict a bit more than needed so that we don't end up doing this every frame when loading new assets.
+    size_t target = _budget - _budget / 8;
+    for (CachedAsset *asset : candidates) {
+        if (_stats.bytes <= target)
+            break;
+
+        asset->evict(); // Might delete the asset.
+        _stats.evictions++;
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class AssetCache;
+
+/**
+ * Profiling counters for `AssetCache`.
+ */
+struct AssetCacheStats {
+    size_t hits = 0; // Lookups that were served from the cache.
+    size_t misses = 0; // Lookups that had to load something, including reloads of evicted assets.
+    size_t evictions = 0; // Number of times an asset was evicted.
+    size_t assets = 0; // Number of assets currently tracked by the cache.
+    size_t bytes = 0; // Memory currently used by the tracked assets, CPU & GPU combined.
+    size_t peakBytes = 0; // Max value of `bytes` so far.
+};
+
+/**
+ * Base class for assets that are tracked by an `AssetCache`.
+ *
+ * Derived classes report their memory usage with `setCachedBytes`, mark themselves as used with `touch`, and
+ * implement `evict`. Evicted assets are expected to transparently reload themselves on next access, so that pointers
+ * to them that are stored all over the codebase stay valid.
+ */
+class CachedAsset {
+ public:
+    CachedAsset() = default;
+    CachedAsset(const CachedAsset &) = delete;
+    CachedAsset &operator=(const CachedAsset &) = delete;
+
+    /**
+     * Marks this asset as used in the current frame.
+     */
+    void touch();
+
+    /**
+     * @param bytes                     Memory used by this asset. Must be updated every time it changes.
+     */
+    void setCachedBytes(size_t bytes);
+
+    /**
+     * @return                          Cache that's tracking this asset, if any.
+     */
+    [[nodiscard]] AssetCache *cache() const {
+        return _cache;
+    }
+
+ protected:
+    virtual ~CachedAsset();
+
+    /**
+     * Frees the memory used by this asset. Implementations must set cached size to zero, or delete the asset.
+     */
+    virtual void evict() = 0;
+
+ private:
+    friend class AssetCache;
+    AssetCache *_cache = nullptr;
+    size_t _index = 0; // Index in `AssetCache::_assets`.
+    size_t _bytes = 0;
+    uint64_t _lastUseFrame = 0;
+};
+
+/**
+ * Memory-budgeted LRU cache for game assets - decoded LOD textures & sprites, and the CPU & GPU copies of the
+ * images from `AssetsManager`.
+ *
+ * The cache doesn't own the assets, it only tracks their memory usage & the last frame in which they were used.
+ * Eviction only happens between frames, in `endFrame`, and assets that were used in the last `MIN_IDLE_FRAMES`
+ * frames are never evicted. This makes it safe for the game code & the renderer to hold on to raw pointers & texture
+ * ids for the duration of a frame.
+ *
+ * This class is not thread-safe, all calls must come from the main thread.
+ */
+class AssetCache {
+ public:
+    /** Assets that were used in this many last frames are not evicted. */
+    static constexpr uint64_t MIN_IDLE_FRAMES = 2;
+
+    AssetCache();
+    ~AssetCache();
+
+    /**
+     * @param budget                    Memory budget in bytes, zero means unlimited.
+     */
+    void setBudget(size_t budget);
+
+    [[nodiscard]] size_t budget() const {
+        return _budget;
+    }
+
+    /**
+     * Starts tracking the provided asset. Asset is considered used in the current frame.
+     *
+     * @param asset                     Asset to track, must not be tracked by any other cache.
+     */
+    void insert(CachedAsset *asset);
+
+    /**
+     * Stops tracking the provided asset. Assets call this automatically when destroyed.
+     *
+     * @param asset                     Asset to stop tracking.
+     */
+    void remove(CachedAsset *asset);
+
+    void recordHit() {
+        _stats.hits++;
+    }
+
+    void recordMiss() {
+        _stats.misses++;
+    }
+
+    /**
+     * Finishes the current frame. If the cache is over budget, evicts the least recently used idle assets until the
+     * memory usage goes below the budget.
+     */
+    void endFrame();
+
+    [[nodiscard]] uint64_t frame() const {
+        return _frame;
+    }
+
+    [[nodiscard]] const AssetCacheStats &stats() const {
+        return _stats;
+    }
+
+ private:
+    friend class CachedAsset;
+    void updateBytes(CachedAsset *asset, size_t bytes);
+
+ private:
+    std::vector<CachedAsset *> _assets;
+    size_t _budget = 0;
+    uint64_t _frame = MIN_IDLE_FRAMES + 1; // So that assets from the first frames can be evicted w/o underflows.
+    AssetCacheStats _stats;
+};
+
+inline void CachedAsset::touch() {
+    if (_cache)
+        _lastUseFrame = _cache->frame();
+}
+
+extern AssetCache *assetCache;
@@ -5,6 +5,8 @@
 #include <string>
 #include <memory>
 
+#include "Engine/Resources/AssetCache.h"
+
 #include "Library/LodFormats/LodFormats.h"
 
 #include "Utility/String/Ascii.h"
@@ -30,6 +32,7 @@ bool LodSpriteCache::open(Blob blob) {
 
 void LodSpriteCache::reserveLoadedSprites() {  // final init
     _reservedCount = _spritesInOrder.size();
+    _reservedMarker = _arena.mark();
 }
 
 void LodSpriteCache::releaseUnreserved() {
@@ -39,33 +42,39 @@ void LodSpriteCache::releaseUnreserved() {
         _spriteByName.erase(name);
         _spritesInOrder.pop_back();
     }
+
+    // Pixel data for all of the sprites that we've just released was allocated after the marker.
+    _arena.rewind(_reservedMarker);
 }
 
 Sprite *LodSpriteCache::loadSprite(std::string_view pContainerName) {
     std::string name = ascii::toLower(pContainerName);
 
     Sprite *result = valuePtr(_spriteByName, name);
-    if (result)
+    if (result) {
+        assetCache->recordHit();
         return result;
+    }
 
-    std::unique_ptr<LodSprite> header = std::make_unique<LodSprite>();
-    if (!LoadSpriteFromFile(header.get(), name))
+    assetCache->recordMiss();
+    LodSpriteView lodSprite;
+    if (!LoadSpriteFromFile(&lodSprite, name))
         return nullptr;
 
     Sprite &sprite = _spriteByName[name];
     sprite.pName = pContainerName;
-    sprite.uWidth = header->image.width();
-    sprite.uHeight = header->image.height();
+    sprite.uWidth = lodSprite.image.width();
+    sprite.uHeight = lodSprite.image.height();
     sprite.texture = assets->getSprite(pContainerName); // TODO(captainurist): very weird dependency here.
-    sprite.sprite_header = header.release();
+    sprite.lodSprite = lodSprite;
     _spritesInOrder.push_back(name);
     return &sprite;
 }
 
-bool LodSpriteCache::LoadSpriteFromFile(LodSprite *pSprite, std::string_view pContainer) {
+bool LodSpriteCache::LoadSpriteFromFile(LodSpriteView *pSprite, std::string_view pContainer) {
     if (!_reader.exists(pContainer))
         return false;
 
-    *pSprite = lod::decodeSprite(_reader.read(pContainer));
+    *pSprite = lod::decodeSprite(_reader.read(pContainer), &_arena);
     return true;
 }
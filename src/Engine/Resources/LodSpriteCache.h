@@ -10,8 +10,10 @@
 #include "Library/Image/Image.h"
 #include "Library/Lod/LodReader.h"
 
+#include "Utility/Memory/Arena.h"
+
 class LodReader;
-struct LodSprite;
+struct LodSpriteView;
 
 class LodSpriteCache {
  public:
@@ -26,11 +28,13 @@ class LodSpriteCache {
     Sprite *loadSprite(std::string_view pContainerName);
 
  private:
-    bool LoadSpriteFromFile(LodSprite *pSprite, std::string_view pContainer);
+    bool LoadSpriteFromFile(LodSpriteView *pSprite, std::string_view pContainer);
 
  private:
     LodReader _reader;
     int _reservedCount = 0;
+    Arena _arena; // Decoded sprite pixels, freed in bulk in `releaseUnreserved`.
+    Arena::Marker _reservedMarker;
     std::unordered_map<std::string, Sprite> _spriteByName;
     std::vector<std::string> _spritesInOrder;
 };
@@ -38,16 +38,28 @@ void LodTextureCache::releaseUnreserved() {
 LodImage *LodTextureCache::loadTexture(std::string_view pContainer, bool useDummyOnError) {
     std::string name = ascii::toLower(pContainer);
 
-    LodImage *result = valuePtr(_textureByName, name);
-    if (result)
-        return result;
+    if (CachedTexture *cached = valuePtr(_textureByName, name)) {
+        if (cached->evicted) {
+            assetCache->recordMiss();
+            LodImage image;
+            LoadTextureFromLOD(&image, name); // Can't fail, the texture was loaded successfully before.
+            cached->setImage(std::move(image));
+        } else {
+            assetCache->recordHit();
+        }
+        cached->touch();
+        return &cached->image;
+    }
 
-    result = &_textureByName[name];
-    if (LoadTextureFromLOD(result, name)) {
+    assetCache->recordMiss();
+    LodImage image;
+    if (LoadTextureFromLOD(&image, name)) {
+        CachedTexture &cached = _textureByName[name];
+        cached.setImage(std::move(image));
+        assetCache->insert(&cached);
         _texturesInOrder.push_back(name);
-        return result;
+        return &cached.image;
     }
-    _textureByName.erase(name);
 
     if (useDummyOnError) {
         return loadTexture("pending", false);
@@ -56,6 +68,29 @@ LodImage *LodTextureCache::loadTexture(std::string_view pContainer, bool useDumm
     }
 }
 
+std::optional<LodImage> LodTextureCache::decodeTexture(std::string_view pContainer) const {
+    if (!_reader.exists(pContainer))
+        return std::nullopt;
+
+    return lod::decodeImage(_reader.read(pContainer));
+}
+
+LodImage *LodTextureCache::insertTexture(std::string_view pContainer, LodImage image) {
+    std::string name = ascii::toLower(pContainer);
+
+    auto [pos, inserted] = _textureByName.try_emplace(name);
+    CachedTexture &cached = pos->second;
+    if (inserted) {
+        cached.setImage(std::move(image));
+        assetCache->insert(&cached);
+        _texturesInOrder.push_back(name);
+    } else if (cached.evicted) {
+        cached.setImage(std::move(image));
+    }
+    cached.touch();
+    return &cached.image;
+}
+
 Blob LodTextureCache::LoadCompressedTexture(std::string_view pContainer) {
     return lod::decodeMaybeCompressed(_reader.read(pContainer));
 }
@@ -71,3 +106,15 @@ bool LodTextureCache::LoadTextureFromLOD(LodImage *pOutTex, std::string_view pCo
     *pOutTex = lod::decodeImage(_reader.read(pContainer));
     return true;
 }
+
+void LodTextureCache::CachedTexture::setImage(LodImage image) {
+    this->image = std::move(image);
+    evicted = false;
+    setCachedBytes(this->image.image.width() * this->image.image.height() + sizeof(Palette));
+}
+
+void LodTextureCache::CachedTexture::evict() {
+    image = LodImage();
+    evicted = true;
+    setCachedBytes(0);
+}
@@ -2,14 +2,17 @@
 
 #include <string>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
+#include "Engine/Resources/AssetCache.h"
+
 #include "Library/Lod/LodReader.h"
+#include "Library/LodFormats/LodImage.h"
 
 #include "Utility/Memory/Blob.h"
 
-struct LodImage;
 class LodReader;
 
 class LodTextureCache {
@@ -24,16 +27,47 @@ class LodTextureCache {
 
     LodImage *loadTexture(std::string_view pContainer, bool useDummyOnError = true);
 
+    /**
+     * Decodes a texture without touching the cache. Unlike the rest of this class, this function can be called from
+     * worker threads, as long as the LOD is not reopened concurrently.
+     *
+     * @param pContainer                Texture name.
+     * @return                          Decoded texture, or `std::nullopt` if there is no such texture in the LOD.
+     */
+    [[nodiscard]] std::optional<LodImage> decodeTexture(std::string_view pContainer) const;
+
+    /**
+     * Adds a texture that was decoded with `decodeTexture` to the cache. Does nothing if the texture is already
+     * in the cache.
+     *
+     * @param pContainer                Texture name.
+     * @param image                     Decoded texture.
+     * @return                          Cached texture.
+     */
+    LodImage *insertTexture(std::string_view pContainer, LodImage image);
+
     Blob LoadCompressedTexture(std::string_view pContainer); // TODO(captainurist): doesn't belong here.
     Blob read(std::string_view pContainer); // TODO(captainurist): doesn't belong here.
 
  private:
+    /**
+     * Decoded texture. These are only needed until they're converted into `GraphicsImage`s, so they are evicted
+     * through the global `AssetCache` and re-decoded on next access.
+     */
+    struct CachedTexture : public CachedAsset {
+        LodImage image;
+        bool evicted = false;
+
+        void setImage(LodImage image);
+        void evict() override;
+    };
+
     bool LoadTextureFromLOD(LodImage *pOutTex, std::string_view pContainer);
 
  private:
     LodReader _reader;
     int _reservedCount = 0;
-    std::unordered_map<std::string, LodImage> _textureByName;
+    std::unordered_map<std::string, CachedTexture> _textureByName;
     std::vector<std::string> _texturesInOrder;
 };
 
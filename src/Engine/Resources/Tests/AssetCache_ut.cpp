@@ -0,0 +1,124 @@
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Resources/AssetCache.h"
+
+namespace {
+class TestAsset : public CachedAsset {
+ public:
+    explicit TestAsset(size_t bytes) : _size(bytes) {
+        setCachedBytes(bytes);
+    }
+
+    void use() {
+        touch();
+        if (!isLoaded()) {
+            cache()->recordMiss();
+            setCachedBytes(_size);
+            _loaded = true;
+        }
+    }
+
+    bool isLoaded() const {
+        return _loaded;
+    }
+
+ protected:
+    void evict() override {
+        _loaded = false;
+        setCachedBytes(0);
+    }
+
+ private:
+    size_t _size = 0;
+    bool _loaded = true;
+};
+} // namespace
+
+UNIT_TEST(AssetCache, Accounting) {
+    AssetCache cache;
+    TestAsset a(100);
+    TestAsset b(200);
+    cache.insert(&a);
+    cache.insert(&b);
+    EXPECT_EQ(cache.stats().assets, 2);
+    EXPECT_EQ(cache.stats().bytes, 300);
+
+    cache.remove(&a);
+    EXPECT_EQ(cache.stats().assets, 1);
+    EXPECT_EQ(cache.stats().bytes, 200);
+    EXPECT_EQ(cache.stats().peakBytes, 300);
+
+    {
+        TestAsset c(50);
+        cache.insert(&c);
+        EXPECT_EQ(cache.stats().bytes, 250);
+    }
+    EXPECT_EQ(cache.stats().assets, 1); // Destructor unregisters.
+    EXPECT_EQ(cache.stats().bytes, 200);
+}
+
+UNIT_TEST(AssetCache, UnlimitedBudget) {
+    AssetCache cache;
+    TestAsset a(1000);
+    cache.insert(&a);
+    for (int i = 0; i < 10; i++)
+        cache.endFrame();
+    EXPECT_TRUE(a.isLoaded());
+    EXPECT_EQ(cache.stats().evictions, 0);
+}
+
+UNIT_TEST(AssetCache, LruEviction) {
+    AssetCache cache;
+    cache.setBudget(250);
+
+    std::vector<TestAsset *> assets;
+    for (int i = 0; i < 3; i++) {
+        assets.push_back(new TestAsset(100));
+        cache.insert(assets.back());
+    }
+
+    // Over budget, but nothing was idle for long enough.
+    cache.endFrame();
+    EXPECT_EQ(cache.stats().evictions, 0);
+
+    for (size_t i = 0; i < AssetCache::MIN_IDLE_FRAMES; i++) {
+        assets[2]->use();
+        assets[1]->use();
+        cache.endFrame();
+    }
+
+    // Least recently used asset is evicted first, and the rest fits into the budget.
+    EXPECT_FALSE(assets[0]->isLoaded());
+    EXPECT_TRUE(assets[1]->isLoaded());
+    EXPECT_TRUE(assets[2]->isLoaded());
+    EXPECT_EQ(cache.stats().evictions, 1);
+    EXPECT_EQ(cache.stats().bytes, 200);
+    EXPECT_EQ(cache.stats().assets, 3);
+
+    for (TestAsset *asset : assets)
+        delete asset;
+    EXPECT_EQ(cache.stats().assets, 0);
+}
+
+UNIT_TEST(AssetCache, Reload) {
+    AssetCache cache;
+    cache.setBudget(50);
+
+    TestAsset a(100);
+    cache.insert(&a);
+    for (size_t i = 0; i <= AssetCache::MIN_IDLE_FRAMES; i++)
+        cache.endFrame();
+    EXPECT_FALSE(a.isLoaded());
+    EXPECT_EQ(cache.stats().bytes, 0);
+
+    a.use();
+    EXPECT_TRUE(a.isLoaded());
+    EXPECT_EQ(cache.stats().misses, 1);
+    EXPECT_EQ(cache.stats().bytes, 100);
+
+    // Just used, shouldn't be evicted even though it's over budget.
+    cache.endFrame();
+    EXPECT_TRUE(a.isLoaded());
+}
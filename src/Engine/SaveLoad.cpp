@@ -2,9 +2,13 @@
 
 #include <cassert>
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <string>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/Resources/EngineFileSystem.h"
@@ -30,13 +34,18 @@
 
 #include "Media/Audio/AudioPlayer.h"
 
+#include "Library/Binary/BinarySerialization.h"
 #include "Library/Snapshots/SnapshotSerialization.h"
 #include "Library/Image/Pcx.h"
 #include "Library/Logger/Logger.h"
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/Lod/LodReader.h"
 #include "Library/Lod/LodWriter.h"
 #include "TurnEngine/TurnEngine.h"
 
+#include "Utility/Concurrency/ThreadPool.h"
+#include "Utility/String/Ascii.h"
+
 SavegameList *pSavegameList = new SavegameList;
 
 static LodInfo makeSaveLodInfo() {
@@ -56,6 +65,8 @@ void LoadGame(int uSlot) {
     pSavegameList->selectedSlot = uSlot;
     pSavegameList->lastLoadedSave = pSavegameList->pFileList[uSlot];
 
+    FinishPendingSave(); // Otherwise it will overwrite pSave_LOD once done.
+
     // TODO(captainurist): remained from Party::Reset, doesn't really belong here (or in Party::Reset).
     current_character_screen_window = WINDOW_CharacterWindow_Stats;
     if (pParty->bTurnBasedModeOn) {
@@ -89,6 +100,7 @@ void LoadGame(int uSlot) {
             //beacon.image = Image::Create(new PCX_LOD_Raw_Loader(pNew_LOD, str));
             beacon.image = GraphicsImage::Create(std::make_unique<PCX_LOD_Raw_Loader>(pSave_LOD.get(), str));
             beacon.image->rgba(); // Force load!
+            beacon.imageSaved = true;
         }
     }
 
@@ -149,47 +161,67 @@ void LoadGame(int uSlot) {
     bFlashHistoryBook = false;
 }
 
-std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view title) {
-    std::pair<SaveGameHeader, Blob> result;
-    auto &[resultHeader, resultBlob] = result;
-    BlobOutputStream lodStream(&resultBlob);
-    LodWriter lodWriter(&lodStream, makeSaveLodInfo());
+/**
+ * Everything that's needed to assemble a save LOD. Doesn't reference any of the game state, so that the expensive
+ * part of saving - serialization, compression, PCX encoding & LOD assembly - can be done on a worker thread.
+ */
+struct SaveSnapshot {
+    SaveGameHeader header;
+    std::vector<std::pair<std::string, Blob>> files; // Files that are copied as is, e.g. deltas for other locations.
+    std::vector<std::pair<std::string, RgbaImage>> images; // Images to encode into PCX.
+    std::string deltaName; // Name of the current location delta file, empty for new games.
+    std::optional<IndoorDelta_MM7> indoorDelta;
+    std::optional<OutdoorDelta_MM7> outdoorDelta;
+    SaveGame_MM7 saveGame;
+};
+
+/**
+ * Save that's being assembled on a worker thread, see `AutoSave`.
+ */
+struct PendingSave {
+    std::future<Blob> blob;
+    std::string path;
+    std::string deltaName;
+};
+
+static std::optional<PendingSave> pendingSave;
+
+static SaveSnapshot captureSaveSnapshot(bool resetWorld, std::string_view title) {
+    SaveSnapshot result;
 
     std::string currentMapName = pMapStats->pInfos[engine->_currentLoadedMapId].fileName;
 
     if (resetWorld) {
         // New game - copy ddm & dlv files.
-        for (const std::string &name : pGames_LOD->ls())
-            if (name.ends_with(".ddm") || name.ends_with(".dlv"))
-                lodWriter.write(name, pGames_LOD->read(name));
+        for (const LodIndexEntry &entry : pGames_LOD->entries())
+            if (entry.name.ends_with(".ddm") || entry.name.ends_with(".dlv"))
+                result.files.emplace_back(entry.name, pGames_LOD->read(entry));
     } else {
-        // Location change - copy map data from the old save & serialize current location delta.
-        for (const std::string &name : pSave_LOD->ls())
-            lodWriter.write(name, pSave_LOD->read(name));
+        // Location change - copy map data from the old save & snapshot current location delta.
+        for (const LodIndexEntry &entry : pSave_LOD->entries())
+            result.files.emplace_back(entry.name, pSave_LOD->read(entry));
 
         currentLocationTime().last_visit = pParty->GetPlayingTime();
         CompactLayingItemsList();
 
-        Blob uncompressed;
         if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-            serialize(*pIndoor, &uncompressed, tags::via<IndoorDelta_MM7>);
+            snapshot(*pIndoor, &result.indoorDelta.emplace());
         } else {
             assert(uCurrentlyLoadedLevelType == LEVEL_OUTDOOR);
-            serialize(*pOutdoor, &uncompressed, tags::via<OutdoorDelta_MM7>);
+            snapshot(*pOutdoor, &result.outdoorDelta.emplace());
         }
 
-        std::string file_name = currentMapName;
-        size_t pos = file_name.find_last_of(".");
-        file_name[pos + 1] = 'd';
-        lodWriter.write(file_name, lod::encodeCompressed(uncompressed));
+        result.deltaName = currentMapName;
+        size_t pos = result.deltaName.find_last_of(".");
+        result.deltaName[pos + 1] = 'd';
     }
 
-    lodWriter.write("image.pcx", pcx::encode(render->MakeViewportScreenshot(150, 112)));
+    result.images.emplace_back("image.pcx", render->MakeViewportScreenshot(150, 112));
 
-    resultHeader.name = title;
-    resultHeader.locationName = currentMapName;
-    resultHeader.playingTime = pParty->GetPlayingTime();
-    serialize(resultHeader, &lodWriter, tags::via<SaveGame_MM7>);
+    result.header.name = title;
+    result.header.locationName = currentMapName;
+    result.header.playingTime = pParty->GetPlayingTime();
+    snapshot(result.header, &result.saveGame);
 
     // TODO(captainurist): incapsulate this too
     for (size_t i = 0; i < 4; ++i) {  // 4 - players
@@ -203,11 +235,37 @@ std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view
             if (beacon.uBeaconTime.isValid() && image != nullptr) {
                 assert(image->rgba());
                 std::string str = fmt::format("lloyd{}{}.pcx", i + 1, j + 1);
-                lodWriter.write(str, pcx::encode(image->rgba()));
+                if (beacon.imageSaved && !resetWorld && pSave_LOD->exists(str)) {
+                    result.files.emplace_back(str, pSave_LOD->read(str)); // Unchanged since the last save, no need to re-encode.
+                } else {
+                    result.images.emplace_back(str, RgbaImage::copy(image->rgba()));
+                }
             }
         }
     }
 
+    return result;
+}
+
+static Blob assembleSaveData(const SaveSnapshot &saveSnapshot, ThreadPool *pool) {
+    Blob result;
+    BlobOutputStream lodStream(&result);
+    LodWriter lodWriter(&lodStream, makeSaveLodInfo());
+
+    for (const auto &[name, data] : saveSnapshot.files)
+        lodWriter.write(name, data);
+
+    if (saveSnapshot.indoorDelta) {
+        lodWriter.write(saveSnapshot.deltaName, lod::encodeCompressed(toBlob(*saveSnapshot.indoorDelta), pool));
+    } else if (saveSnapshot.outdoorDelta) {
+        lodWriter.write(saveSnapshot.deltaName, lod::encodeCompressed(toBlob(*saveSnapshot.outdoorDelta), pool));
+    }
+
+    for (const auto &[name, image] : saveSnapshot.images)
+        lodWriter.write(name, pcx::encode(image));
+
+    serialize(saveSnapshot.saveGame, &lodWriter);
+
     // Apparently vanilla had two bugs canceling each other out:
     // 1. Broken binary search implementation when looking up LOD entries.
     // 2. Writing additional duplicate entry at the end of a saves LOD file.
@@ -218,6 +276,21 @@ std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view
     return result;
 }
 
+static void setBeaconImagesSaved(bool saved) {
+    for (Character &character : pParty->pCharacters)
+        for (std::optional<LloydBeacon> &beacon : character.vBeacons)
+            if (beacon && beacon->uBeaconTime.isValid() && beacon->image)
+                beacon->imageSaved = saved;
+}
+
+std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view title) {
+    FinishPendingSave(); // Snapshot copies files from pSave_LOD, so it should be up to date.
+
+    SaveSnapshot saveSnapshot = captureSaveSnapshot(resetWorld, title);
+    Blob blob = assembleSaveData(saveSnapshot, engine->threadPool());
+    return {std::move(saveSnapshot.header), std::move(blob)};
+}
+
 SaveGameHeader SaveGame(bool isAutoSave, bool resetWorld, std::string_view path, std::string_view title) {
     assert(isAutoSave || !title.empty());
     assert(engine->_currentLoadedMapId != MAP_ARENA || isAutoSave); // No manual saves in Arena.
@@ -246,11 +319,63 @@ SaveGameHeader SaveGame(bool isAutoSave, bool resetWorld, std::string_view path,
 
     pSave_LOD->open(std::move(blob), LOD_ALLOW_DUPLICATES);
 
+    // All beacon images are now in the save LOD, so the next save can just copy them over.
+    setBeaconImagesSaved(true);
+
     return std::move(header);
 }
 
 void AutoSave() {
-    SaveGame(true, false, "saves/autosave.mm7");
+    if (engine->_currentLoadedMapId == MAP_ARENA)
+        return;
+
+    FinishPendingSave();
+
+    // Only the snapshot is taken on the game thread, the rest is done on a worker. LodWriter doesn't copy the data,
+    // so the blobs shared from pSave_LOD are just kept alive until the save is assembled.
+    std::shared_ptr<SaveSnapshot> saveSnapshot = std::make_shared<SaveSnapshot>(captureSaveSnapshot(false, {}));
+    ThreadPool *pool = engine->threadPool();
+
+    PendingSave &save = pendingSave.emplace();
+    save.path = "saves/autosave.mm7";
+    save.deltaName = saveSnapshot->deltaName;
+    save.blob = pool->submit([saveSnapshot, pool] { return assembleSaveData(*saveSnapshot, pool); });
+
+    // Beacon images will be in pSave_LOD once the save is finished, and FinishPendingSave is always called before
+    // the next snapshot is taken.
+    setBeaconImagesSaved(true);
+}
+
+static void finishPendingSaveInternal() {
+    assert(pendingSave);
+
+    PendingSave save = std::move(*pendingSave);
+    pendingSave.reset();
+
+    try {
+        Blob blob = save.blob.get();
+        ufs->write(save.path, blob);
+        pSave_LOD->open(std::move(blob), LOD_ALLOW_DUPLICATES);
+    } catch (const std::exception &e) {
+        logger->error("Couldn't write autosave '{}': {}", save.path, e.what());
+        setBeaconImagesSaved(false); // pSave_LOD wasn't updated.
+    }
+}
+
+void FinishPendingSave() {
+    if (pendingSave)
+        finishPendingSaveInternal();
+}
+
+void FinishPendingSave(std::string_view deltaName) {
+    if (pendingSave && ascii::noCaseEquals(pendingSave->deltaName, deltaName))
+        finishPendingSaveInternal();
+}
+
+bool PollPendingSave() {
+    if (pendingSave && pendingSave->blob.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        finishPendingSaveInternal();
+    return !pendingSave;
 }
 
 void DoSavegame(int uSlot) {
@@ -277,6 +402,8 @@ void DoSavegame(int uSlot) {
 }
 
 void SavegameList::Initialize() {
+    FinishPendingSave(); // Make sure the autosave is on disk.
+
     pSavegameList->Reset();
 
     if (ufs->exists("saves")) {
@@ -38,7 +38,39 @@ struct SavegameList {
 void LoadGame(int uSlot);
 std::pair<SaveGameHeader, Blob> CreateSaveData(bool resetWorld, std::string_view title);
 SaveGameHeader SaveGame(bool isAutoSave, bool resetWorld, std::string_view path, std::string_view title = {});
+
+/**
+ * Saves the game into the autosave slot. Only a snapshot of the game state is taken on the calling thread, the save
+ * is assembled on a worker thread, and the result is picked up by `PollPendingSave`, which the game loop calls every
+ * frame.
+ *
+ * Until the save is finished, `pSave_LOD` is not updated, see `FinishPendingSave`.
+ */
 void AutoSave();
+
+/**
+ * Waits for the save started by `AutoSave` to be assembled, writes it to disk and reopens `pSave_LOD`. Does nothing
+ * if there is no save in progress.
+ *
+ * Must be called before accessing `pSave_LOD` or the save files, with the exception of reading location deltas - see
+ * the overload below.
+ */
+void FinishPendingSave();
+
+/**
+ * Same as `FinishPendingSave()`, but only waits if the save in progress contains the provided location delta.
+ *
+ * @param deltaName                     Name of the location delta file in `pSave_LOD`, e.g. "d01.dlv".
+ */
+void FinishPendingSave(std::string_view deltaName);
+
+/**
+ * Non-blocking version of `FinishPendingSave()`. Called from the game loop every frame.
+ *
+ * @return                              Whether there is no save in progress anymore.
+ */
+bool PollPendingSave();
+
 void DoSavegame(int uSlot);
 bool Initialize_GamesLOD_NewLOD();
 void SaveNewGame();
@@ -41,6 +41,7 @@ void deserialize(const Blob &src, IconFrameTable *dst) {
     dst->_frames.clear();
     deserialize(src, &dst->_frames, tags::append, tags::via<IconFrameData_MM7>);
     dst->_textures.resize(dst->_frames.size());
+    dst->buildIndex();
 
     assert(!dst->_frames.empty());
 }
@@ -81,6 +82,7 @@ void deserialize(const Blob &src, SpriteFrameTable *dst) {
 void deserialize(const Blob &src, TextureFrameTable *dst) {
     deserialize(src, &dst->_frames, tags::append, tags::via<TextureFrameData_MM7>);
     dst->_textures.resize(dst->_frames.size());
+    dst->buildIndex();
 
     assert(!dst->_frames.empty());
 }
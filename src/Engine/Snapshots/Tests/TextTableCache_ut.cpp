@@ -0,0 +1,286 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Engine/Snapshots/TextTableCache.h"
+#include "Engine/Tables/AutonoteTable.h"
+#include "Engine/Tables/AwardTable.h"
+#include "Engine/Tables/HouseTable.h"
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Tables/MerchantTable.h"
+#include "Engine/Tables/NPCTable.h"
+#include "Engine/Tables/QuestTable.h"
+#include "Engine/Tables/TransitionTable.h"
+
+#include "Utility/Memory/Blob.h"
+#include "Utility/String/Format.h"
+
+namespace {
+
+constexpr uint64_t CACHE_KEY = 0x0123456789ABCDEF;
+
+/**
+ * Owns the table objects that are accessed through global pointers, & resets all the text tables to default values
+ * on construction.
+ */
+class TestTables {
+ public:
+    TestTables() {
+        pItemTable = _itemTable.get();
+        pNPCStats = _npcStats.get();
+        pNPCTopics.fill({});
+        houseTable.fill({});
+        pMerchantsBuyPhrases.fill({});
+        pMerchantsSellPhrases.fill({});
+        pMerchantsRepairPhrases.fill({});
+        pMerchantsIdentifyPhrases.fill({});
+        pQuestTable.fill({});
+        pAutonoteTxt.fill({});
+        pAwards.fill({});
+        pTransitionStrings.fill({});
+    }
+
+    ~TestTables() {
+        pItemTable = nullptr;
+        pNPCStats = nullptr;
+    }
+
+ private:
+    std::unique_ptr<ItemTable> _itemTable = std::make_unique<ItemTable>();
+    std::unique_ptr<NPCStats> _npcStats = std::make_unique<NPCStats>();
+};
+
+void fillTables() {
+    int counter = 1;
+
+    for (ItemData &item : pItemTable->items) {
+        item.iconName = fmt::format("icon{}", counter);
+        item.name = fmt::format("name{}", counter);
+        item.unidentifiedName = fmt::format("unidentified{}", counter);
+        item.description = fmt::format("description{}", counter);
+        item.baseValue = counter++;
+        item.spriteId = SPRITE_PROJECTILE_FIRE_BOLT;
+        item.paperdollAnchorOffset = Pointi(counter, -counter);
+        counter++;
+        item.type = ITEM_TYPE_ARMOUR;
+        item.skill = SKILL_SWORD;
+        item.damageDice = counter++;
+        item.damageRoll = counter++;
+        item.damageMod = counter++;
+        item.reagentPower = counter++;
+        item.rarity = RARITY_ARTIFACT;
+        item.specialEnchantment = ITEM_ENCHANTMENT_OF_CARNAGE;
+        item.standardEnchantment = ATTRIBUTE_MIGHT;
+        item.standardEnchantmentStrength = counter++;
+        for (int &chance : item.uChanceByTreasureLvl)
+            chance = counter++;
+        item.identifyAndRepairDifficulty = counter++;
+    }
+
+    for (StandardEnchantmentData &enchantment : pItemTable->standardEnchantments) {
+        enchantment.attributeName = fmt::format("attribute{}", counter++);
+        enchantment.itemSuffix = fmt::format("suffix{}", counter++);
+        for (unsigned char &chance : enchantment.chanceByItemType)
+            chance = counter++ % 256;
+    }
+
+    for (SpecialEnchantmentData &enchantment : pItemTable->specialEnchantments) {
+        enchantment.description = fmt::format("description{}", counter++);
+        enchantment.itemSuffixOrPrefix = fmt::format("suffix{}", counter++);
+        for (char &chance : enchantment.chanceByItemType)
+            chance = counter++ % 128;
+        enchantment.additionalValue = counter++;
+        enchantment.iTreasureLevel = counter++;
+    }
+
+    pItemTable->field_9FC4[0] = 1;
+    pItemTable->field_EDE0[383] = 2;
+    pItemTable->potionCombination[ITEM_FIRST_REAL_POTION][ITEM_FIRST_REAL_POTION] = ITEM_CRUDE_LONGSWORD;
+    pItemTable->potionNotes[ITEM_FIRST_REAL_POTION][ITEM_FIRST_REAL_POTION] = counter++;
+    pItemTable->itemChanceSumByTreasureLevel[ITEM_TREASURE_LEVEL_3] = counter++;
+    pItemTable->standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_3] = counter++;
+    pItemTable->specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_3] = counter++;
+    pItemTable->specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_3] = counter++;
+    pItemTable->standardEnchantmentChanceSumByItemType[ITEM_TYPE_ARMOUR] = counter++;
+    pItemTable->standardEnchantmentRangeByTreasureLevel[ITEM_TREASURE_LEVEL_3] = Segment(counter, counter + 1);
+    counter += 2;
+    pItemTable->itemSizes[ITEM_CRUDE_LONGSWORD] = Sizei(3, 4); // Not cached.
+
+    for (NPCData &npc : pNPCStats->pNPCData) {
+        npc.name = fmt::format("npc{}", counter++);
+        npc.uPortraitID = counter++;
+        npc.uFlags = NPC_HIRED;
+        npc.fame = counter++;
+        npc.rep = counter++;
+        npc.Location2D = HOUSE_WEAPON_SHOP_EMERALD_ISLAND;
+        npc.profession = Porter;
+        npc.greet = counter++;
+        npc.is_joinable = counter++;
+        npc.field_24 = counter++;
+        npc.dialogue_1_evt_id = counter++;
+        npc.dialogue_2_evt_id = counter++;
+        npc.dialogue_3_evt_id = counter++;
+        npc.dialogue_4_evt_id = counter++;
+        npc.dialogue_5_evt_id = counter++;
+        npc.dialogue_6_evt_id = counter++;
+        npc.uSex = SEX_FEMALE;
+        npc.bHasUsedTheAbility = counter++;
+        npc.news_topic = counter++;
+    }
+    pNPCStats->pOriginalNPCData = pNPCStats->pNPCData;
+    pNPCStats->pAdditionalNPC[99] = pNPCStats->pNPCData[500];
+    pNPCStats->pNPCNames[539][SEX_FEMALE] = "name";
+    pNPCStats->pProfessions[Porter].uHirePrice = counter++;
+    pNPCStats->pProfessions[Porter].pBenefits = "benefits";
+    pNPCStats->pProfessions[Porter].pActionText = "action";
+    pNPCStats->pProfessions[Porter].pJoinText = "join";
+    pNPCStats->pProfessions[Porter].pDismissText = "dismiss";
+    pNPCStats->pCatchPhrases[51] = "catchphrase";
+    pNPCStats->pNPCUnicNames[499] = "unique";
+    pNPCStats->pProfessionChance[76].uTotalprofChance = counter++;
+    pNPCStats->pProfessionChance[76].professionChancePerArea[59] = 42;
+    pNPCStats->field_17884 = counter++;
+    pNPCStats->field_17888 = counter++;
+    pNPCStats->pNPCGreetings[205].pGreeting1 = "greeting1";
+    pNPCStats->pNPCGreetings[205].pGreeting2 = "greeting2";
+    pNPCStats->pOriginalGroups[50] = counter++;
+    pNPCStats->pGroups[50] = counter++;
+    pNPCStats->uNewlNPCBufPos = counter++;
+    pNPCStats->uNumNewNPCs = counter++;
+    pNPCStats->field_17FC8 = counter++;
+    pNPCStats->uNumNPCProfessions = counter++;
+    pNPCStats->uNumNPCNames[SEX_FEMALE] = counter++;
+
+    for (NPCTopic &topic : pNPCTopics) {
+        topic.pTopic = fmt::format("topic{}", counter++);
+        topic.pText = fmt::format("text{}", counter++);
+    }
+
+    for (HouseData &house : houseTable) {
+        house.uType = HOUSE_TYPE_WEAPON_SHOP;
+        house.uAnimationID = counter++;
+        house.name = fmt::format("house{}", counter++);
+        house.pProprieterName = "proprietor";
+        house.pEnterText = "enter";
+        house.pProprieterTitle = "title";
+        house.field_14 = counter++;
+        house._state = counter++;
+        house._rep = counter++;
+        house._per = counter++;
+        house.generation_interval_days = counter++;
+        house.field_1E = counter++;
+        house.fPriceMultiplier = 1.5f;
+        house.flt_24 = 2.5f;
+        house.uOpenTime = counter++;
+        house.uCloseTime = counter++;
+        house.uExitPicID = counter++;
+        house.uExitMapID = MAP_EMERALD_ISLAND;
+        house._quest_bit = QBIT_EMERALD_ISLAND_SEASHELL_ACTIVE;
+        house.field_32 = counter++;
+    }
+
+    for (std::string &phrase : pMerchantsBuyPhrases)
+        phrase = fmt::format("buy{}", counter++);
+    for (std::string &phrase : pMerchantsSellPhrases)
+        phrase = fmt::format("sell{}", counter++);
+    for (std::string &phrase : pMerchantsRepairPhrases)
+        phrase = fmt::format("repair{}", counter++);
+    for (std::string &phrase : pMerchantsIdentifyPhrases)
+        phrase = fmt::format("identify{}", counter++);
+    for (std::string &quest : pQuestTable)
+        quest = fmt::format("quest{}", counter++);
+
+    for (AutonoteData &autonote : pAutonoteTxt) {
+        autonote.pText = fmt::format("autonote{}", counter++);
+        autonote.eType = AUTONOTE_OBELISK;
+    }
+
+    for (AwardData &award : pAwards) {
+        award.pText = fmt::format("award{}", counter++);
+        award.uPriority = counter++;
+    }
+
+    for (std::string &transition : pTransitionStrings)
+        transition = fmt::format("transition{}", counter++);
+}
+
+} // namespace
+
+UNIT_TEST(TextTableCache, RoundTrip) {
+    Blob cache;
+    ItemData lastItem;
+    SpecialEnchantmentData lastSpecialEnchantment;
+    NPCData lastNpc;
+    HouseData lastHouse;
+    AwardData lastAward;
+    int numFemaleNames = 0;
+    {
+        TestTables tables;
+        fillTables();
+        cache = saveTextTablesCache(CACHE_KEY);
+        lastItem = pItemTable->items[ITEM_LAST_VALID];
+        lastSpecialEnchantment = pItemTable->specialEnchantments[ITEM_ENCHANTMENT_LAST_VALID];
+        lastNpc = pNPCStats->pNPCData[500];
+        lastHouse = houseTable[HOUSE_LAST];
+        lastAward = pAwards[AWARD_LAST];
+        numFemaleNames = pNPCStats->uNumNPCNames[SEX_FEMALE];
+    }
+
+    TestTables tables;
+    EXPECT_TRUE(loadTextTablesCache(cache, CACHE_KEY));
+
+    // Spot-check the first & the last values of each table.
+    const ItemData &item = pItemTable->items[ITEM_FIRST_VALID];
+    EXPECT_EQ(item.iconName, "icon1");
+    EXPECT_EQ(item.baseValue, 1);
+    EXPECT_EQ(item.paperdollAnchorOffset, Pointi(2, -2));
+    EXPECT_EQ(item.type, ITEM_TYPE_ARMOUR);
+    EXPECT_EQ(item.standardEnchantment, ATTRIBUTE_MIGHT);
+    EXPECT_EQ(pItemTable->field_EDE0[383], 2);
+    EXPECT_EQ(pItemTable->potionCombination[ITEM_FIRST_REAL_POTION][ITEM_FIRST_REAL_POTION], ITEM_CRUDE_LONGSWORD);
+    EXPECT_EQ(pItemTable->itemSizes[ITEM_CRUDE_LONGSWORD], Sizei()); // Not cached.
+    EXPECT_EQ(pItemTable->items[ITEM_LAST_VALID].uChanceByTreasureLvl, lastItem.uChanceByTreasureLvl);
+    EXPECT_EQ(pItemTable->items[ITEM_LAST_VALID].identifyAndRepairDifficulty, lastItem.identifyAndRepairDifficulty);
+    EXPECT_EQ(pItemTable->specialEnchantments[ITEM_ENCHANTMENT_LAST_VALID].chanceByItemType,
+              lastSpecialEnchantment.chanceByItemType);
+    EXPECT_EQ(pItemTable->specialEnchantments[ITEM_ENCHANTMENT_LAST_VALID].iTreasureLevel,
+              lastSpecialEnchantment.iTreasureLevel);
+    EXPECT_EQ(pItemTable->standardEnchantmentRangeByTreasureLevel[ITEM_TREASURE_LEVEL_3].back(),
+              pItemTable->standardEnchantmentRangeByTreasureLevel[ITEM_TREASURE_LEVEL_3].front() + 1);
+    EXPECT_EQ(pNPCStats->pNPCData[500].uFlags, NPC_HIRED);
+    EXPECT_EQ(pNPCStats->pNPCData[500].news_topic, lastNpc.news_topic);
+    EXPECT_EQ(pNPCStats->uNumNPCNames[SEX_FEMALE], numFemaleNames);
+    EXPECT_EQ(pNPCStats->pAdditionalNPC[99].name, pNPCStats->pNPCData[500].name);
+    EXPECT_EQ(pNPCStats->pNPCNames[539][SEX_FEMALE], "name");
+    EXPECT_EQ(pNPCStats->pProfessions[Porter].pDismissText, "dismiss");
+    EXPECT_EQ(pNPCStats->pProfessionChance[76].professionChancePerArea[59], 42);
+    EXPECT_EQ(pNPCStats->pNPCGreetings[205].pGreeting2, "greeting2");
+    EXPECT_EQ(houseTable[HOUSE_FIRST].uExitMapID, MAP_EMERALD_ISLAND);
+    EXPECT_EQ(houseTable[HOUSE_LAST].flt_24, 2.5f);
+    EXPECT_EQ(houseTable[HOUSE_LAST].field_32, lastHouse.field_32);
+    EXPECT_TRUE(pMerchantsIdentifyPhrases[MERCHANT_PHRASE_LAST].starts_with("identify"));
+    EXPECT_TRUE(pQuestTable[QBIT_LAST].starts_with("quest"));
+    EXPECT_EQ(pAutonoteTxt.back().eType, AUTONOTE_OBELISK);
+    EXPECT_EQ(pAwards[AWARD_LAST].pText, lastAward.pText);
+    EXPECT_EQ(pAwards[AWARD_LAST].uPriority, lastAward.uPriority);
+    EXPECT_TRUE(pTransitionStrings.back().starts_with("transition"));
+
+    // Full check - loaded tables should serialize into exactly the same data.
+    Blob cache2 = saveTextTablesCache(CACHE_KEY);
+    EXPECT_EQ(cache.string_view(), cache2.string_view());
+}
+
+UNIT_TEST(TextTableCache, StaleKey) {
+    Blob cache;
+    {
+        TestTables tables;
+        fillTables();
+        cache = saveTextTablesCache(CACHE_KEY);
+    }
+
+    TestTables tables;
+    EXPECT_FALSE(loadTextTablesCache(cache, CACHE_KEY + 1));
+    EXPECT_TRUE(pNPCTopics[0].pTopic.empty());
+}
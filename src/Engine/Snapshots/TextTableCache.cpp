@@ -0,0 +1,330 @@
+#include "TextTableCache.h"
+
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Engine/Tables/AutonoteTable.h"
+#include "Engine/Tables/AwardTable.h"
+#include "Engine/Tables/HouseTable.h"
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Tables/MerchantTable.h"
+#include "Engine/Tables/NPCTable.h"
+#include "Engine/Tables/QuestTable.h"
+#include "Engine/Tables/TransitionTable.h"
+#include "Engine/Resources/ResourceManager.h"
+
+#include "Library/Binary/BinarySerialization.h"
+#include "Library/BuildInfo/BuildInfo.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/Streams/MemoryInputStream.h"
+#include "Utility/Memory/Blob.h"
+#include "Utility/Segment.h"
+#include "Utility/Hash.h"
+#include "Utility/Flags.h"
+
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x43545845; // "EXTC".
+constexpr uint32_t CACHE_VERSION = 1; // Bump this when the set of cached tables changes.
+
+constexpr std::string_view SOURCE_FILES[] = {
+    "potion.txt", "potnotes.txt", "stditems.txt", "spcitems.txt", "items.txt", "rnditems.txt",
+    "npcdata.txt", "npcgreet.txt", "npcgroup.txt", "npcnews.txt", "npctext.txt", "npctopic.txt", "npcdist.txt",
+    "npcnames.txt", "npcprof.txt",
+    "2dEvents.txt", "merchant.txt", "quests.txt", "autonote.txt", "awards.txt", "trans.txt"
+};
+
+/**
+ * Writes the visited values into an output stream. Paired with `CacheReader`, both are driven by the same `visit`
+ * function, so that the read & write code can't go out of sync.
+ */
+class CacheWriter {
+ public:
+    explicit CacheWriter(OutputStream *dst) : _dst(dst) {}
+
+    template<class T>
+    void leaf(T &value) {
+        serialize(value, _dst);
+    }
+
+ private:
+    OutputStream *_dst = nullptr;
+};
+
+/**
+ * Reads the visited values from an input stream.
+ */
+class CacheReader {
+ public:
+    explicit CacheReader(InputStream *src) : _src(src) {}
+
+    template<class T>
+    void leaf(T &value) {
+        deserialize(*_src, &value);
+    }
+
+ private:
+    InputStream *_src = nullptr;
+};
+
+template<class T>
+struct is_flags : std::false_type {};
+template<class Enum>
+struct is_flags<Flags<Enum>> : std::true_type {};
+
+template<class T>
+struct is_optional : std::false_type {};
+template<class T>
+struct is_optional<std::optional<T>> : std::true_type {};
+
+template<class Visitor, class T>
+void visit(Visitor &visitor, T &value);
+
+template<class Visitor, class... Ts>
+void visitAll(Visitor &visitor, Ts &... values) {
+    (visit(visitor, values), ...);
+}
+
+// The visitFields functions below have to list every field of the cached structs, a field that's missing there would
+// be silently left default-initialized when loading from the cache. Fields are bound with structured bindings, which
+// fail to compile if the number of names doesn't match the number of fields in the struct. So whoever adds or removes
+// a field gets a compilation error here, on every toolchain. Cache key includes the git revision, so stale caches
+// are not read after such a change.
+
+template<class Visitor>
+void visitFields(Visitor &visitor, Pointi &value) {
+    auto &[x, y] = value;
+    visitAll(visitor, x, y);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, ItemData &value) {
+    auto &[iconName, name, unidentifiedName, description, baseValue, spriteId, paperdollAnchorOffset, type, skill,
+           damageDice, damageRoll, damageMod, reagentPower, rarity, specialEnchantment, standardEnchantment,
+           standardEnchantmentStrength, uChanceByTreasureLvl, identifyAndRepairDifficulty] = value;
+    visitAll(visitor, iconName, name, unidentifiedName, description, baseValue, spriteId, paperdollAnchorOffset, type,
+             skill, damageDice, damageRoll, damageMod, reagentPower, rarity, specialEnchantment, standardEnchantment,
+             standardEnchantmentStrength, uChanceByTreasureLvl, identifyAndRepairDifficulty);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, StandardEnchantmentData &value) {
+    auto &[attributeName, itemSuffix, chanceByItemType] = value;
+    visitAll(visitor, attributeName, itemSuffix, chanceByItemType);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, SpecialEnchantmentData &value) {
+    auto &[description, itemSuffixOrPrefix, chanceByItemType, additionalValue, iTreasureLevel] = value;
+    visitAll(visitor, description, itemSuffixOrPrefix, chanceByItemType, additionalValue, iTreasureLevel);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, ItemTable &value) {
+    [[maybe_unused]] auto &[items, itemSizes, standardEnchantments, specialEnchantments, field_9FC4, field_B348,
+                            field_C6D0, field_DA58, field_EDE0, potionCombination, potionNotes,
+                            itemChanceSumByTreasureLevel, standardEnchantmentChanceForEquipment,
+                            specialEnchantmentChanceForEquipment, specialEnchantmentChanceForWeapons,
+                            standardEnchantmentChanceSumByItemType, standardEnchantmentRangeByTreasureLevel] = value;
+    // itemSizes are calculated from the item textures, and are not cached.
+    visitAll(visitor, items, standardEnchantments, specialEnchantments, field_9FC4, field_B348, field_C6D0, field_DA58,
+             field_EDE0, potionCombination, potionNotes, itemChanceSumByTreasureLevel,
+             standardEnchantmentChanceForEquipment, specialEnchantmentChanceForEquipment,
+             specialEnchantmentChanceForWeapons, standardEnchantmentChanceSumByItemType,
+             standardEnchantmentRangeByTreasureLevel);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, NPCTopic &value) {
+    auto &[pTopic, pText] = value;
+    visitAll(visitor, pTopic, pText);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, NPCData &value) {
+    auto &[name, uPortraitID, uFlags, fame, rep, Location2D, profession, greet, is_joinable, field_24,
+           dialogue_1_evt_id, dialogue_2_evt_id, dialogue_3_evt_id, dialogue_4_evt_id, dialogue_5_evt_id,
+           dialogue_6_evt_id, uSex, bHasUsedTheAbility, news_topic] = value;
+    visitAll(visitor, name, uPortraitID, uFlags, fame, rep, Location2D, profession, greet, is_joinable, field_24,
+             dialogue_1_evt_id, dialogue_2_evt_id, dialogue_3_evt_id, dialogue_4_evt_id, dialogue_5_evt_id,
+             dialogue_6_evt_id, uSex, bHasUsedTheAbility, news_topic);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, NPCProfession &value) {
+    auto &[uHirePrice, pBenefits, pActionText, pJoinText, pDismissText] = value;
+    visitAll(visitor, uHirePrice, pBenefits, pActionText, pJoinText, pDismissText);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, NPCProfessionChance &value) {
+    auto &[uTotalprofChance, professionChancePerArea] = value;
+    visitAll(visitor, uTotalprofChance, professionChancePerArea);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, NPCGreeting &value) {
+    auto &[pGreeting1, pGreeting2] = value;
+    visitAll(visitor, pGreeting1, pGreeting2);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, NPCStats &value) {
+    auto &[pOriginalNPCData, pNPCData, pNPCNames, pProfessions, pAdditionalNPC, pCatchPhrases, pNPCUnicNames,
+           pProfessionChance, field_17884, field_17888, pNPCGreetings, pOriginalGroups, pGroups, uNewlNPCBufPos,
+           uNumNewNPCs, field_17FC8, uNumNPCProfessions, uNumNPCNames] = value;
+    visitAll(visitor, pOriginalNPCData, pNPCData, pNPCNames, pProfessions, pAdditionalNPC, pCatchPhrases,
+             pNPCUnicNames, pProfessionChance, field_17884, field_17888, pNPCGreetings, pOriginalGroups, pGroups,
+             uNewlNPCBufPos, uNumNewNPCs, field_17FC8, uNumNPCProfessions, uNumNPCNames);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, HouseData &value) {
+    auto &[uType, uAnimationID, name, pProprieterName, pEnterText, pProprieterTitle, field_14, _state, _rep, _per,
+           generation_interval_days, field_1E, fPriceMultiplier, flt_24, uOpenTime, uCloseTime, uExitPicID,
+           uExitMapID, _quest_bit, field_32] = value;
+    visitAll(visitor, uType, uAnimationID, name, pProprieterName, pEnterText, pProprieterTitle, field_14, _state, _rep,
+             _per, generation_interval_days, field_1E, fPriceMultiplier, flt_24, uOpenTime, uCloseTime, uExitPicID,
+             uExitMapID, _quest_bit, field_32);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, AutonoteData &value) {
+    auto &[pText, eType] = value;
+    visitAll(visitor, pText, eType);
+}
+
+template<class Visitor>
+void visitFields(Visitor &visitor, AwardData &value) {
+    auto &[pText, uPriority] = value;
+    visitAll(visitor, pText, uPriority);
+}
+
+template<class Visitor, class T>
+void visit(Visitor &visitor, T &value) {
+    if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, std::string>) {
+        visitor.leaf(value);
+    } else if constexpr (std::is_enum_v<T>) {
+        std::underlying_type_t<T> tmp = std::to_underlying(value);
+        visit(visitor, tmp);
+        value = static_cast<T>(tmp);
+    } else if constexpr (is_flags<T>::value) {
+        typename T::underlying_type tmp = static_cast<typename T::underlying_type>(value);
+        visit(visitor, tmp);
+        value = T(tmp);
+    } else if constexpr (std::is_same_v<T, Segment<int>>) {
+        int front = value.front();
+        int back = value.back();
+        visit(visitor, front);
+        visit(visitor, back);
+        value = Segment<int>(front, back);
+    } else if constexpr (is_optional<T>::value) {
+        bool hasValue = value.has_value();
+        visit(visitor, hasValue);
+        if (!hasValue) {
+            value.reset();
+        } else {
+            if (!value)
+                value.emplace();
+            visit(visitor, *value);
+        }
+    } else if constexpr (std::ranges::contiguous_range<T>) {
+        using Element = std::ranges::range_value_t<T>;
+        if constexpr (std::is_arithmetic_v<Element>) {
+            std::span<Element> span(std::ranges::data(value), std::ranges::size(value));
+            visitor.leaf(span); // Single memcpy for the whole array.
+        } else {
+            for (Element &element : value)
+                visit(visitor, element);
+        }
+    } else {
+        visitFields(visitor, value);
+    }
+}
+
+template<class Visitor>
+void visitTables(Visitor &visitor) {
+    visit(visitor, *pItemTable);
+    visit(visitor, *pNPCStats);
+    visit(visitor, pNPCTopics);
+    visit(visitor, houseTable);
+    visit(visitor, pMerchantsBuyPhrases);
+    visit(visitor, pMerchantsSellPhrases);
+    visit(visitor, pMerchantsRepairPhrases);
+    visit(visitor, pMerchantsIdentifyPhrases);
+    visit(visitor, pQuestTable);
+    visit(visitor, pAutonoteTxt);
+    visit(visitor, pAwards);
+    visit(visitor, pTransitionStrings);
+}
+
+} // namespace
+
+uint64_t textTablesCacheKey(ResourceManager *resourceManager) {
+    Fnv1aHasher hasher;
+    hasher.add(CACHE_VERSION);
+    hasher.add(gitRevision());
+    hasher.add(buildTime());
+    for (std::string_view fileName : SOURCE_FILES) {
+        Blob blob = resourceManager->eventsData(fileName);
+        hasher.add(fileName);
+        hasher.add(blob.string_view());
+    }
+    return hasher.hash();
+}
+
+bool loadTextTablesCache(const Blob &cache, uint64_t key) {
+    try {
+        MemoryInputStream stream(cache.data(), cache.size(), cache.displayPath());
+        CacheReader reader(&stream);
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint64_t cacheKey = 0;
+        reader.leaf(magic);
+        reader.leaf(version);
+        reader.leaf(cacheKey);
+        if (magic != CACHE_MAGIC || version != CACHE_VERSION || cacheKey != key)
+            return false; // Stale cache, not an error.
+
+        visitTables(reader);
+
+        uint32_t endMagic = 0;
+        reader.leaf(endMagic);
+        if (endMagic != CACHE_MAGIC || stream.position() != stream.size()) {
+            logger->warning("Text table cache '{}' is corrupted", cache.displayPath());
+            return false;
+        }
+    } catch (const std::exception &e) {
+        logger->warning("Could not load text table cache '{}': {}", cache.displayPath(), e.what());
+        return false;
+    }
+
+    return true;
+}
+
+Blob saveTextTablesCache(uint64_t key) {
+    Blob result;
+    BlobOutputStream stream(&result, "text_tables.bin");
+    CacheWriter writer(&stream);
+
+    uint32_t magic = CACHE_MAGIC;
+    uint32_t version = CACHE_VERSION;
+    writer.leaf(magic);
+    writer.leaf(version);
+    writer.leaf(key);
+    visitTables(writer);
+    writer.leaf(magic);
+
+    stream.close();
+    return result;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+class Blob;
+class ResourceManager;
+
+/**
+ * Binary cache for the fully parsed text tables - items, NPC data, houses, merchants, quests, autonotes, awards and
+ * transitions. Parsing these tables is a noticeable part of the startup time, while loading them from the cache
+ * boils down to a bunch of `memcpy` calls.
+ *
+ * Example usage:
+ * ```
+ * uint64_t key = textTablesCacheKey(resourceManager);
+ * if (!ufs->exists(path) || !loadTextTablesCache(ufs->read(path), key)) {
+ *     parseTextTables();
+ *     ufs->write(path, saveTextTablesCache(key));
+ * }
+ * ```
+ *
+ * Data that's derived from other resources (e.g. `ItemTable::itemSizes`) is not cached, and must be recalculated
+ * after the cache is loaded.
+ */
+
+/**
+ * @param resourceManager               Resource manager to read the source text tables from.
+ * @return                              Cache key - hash of the source text tables, of the cache format version, and
+ *                                      of the current build. The latter makes sure that changes to the parsing code
+ *                                      invalidate the cache.
+ */
+uint64_t textTablesCacheKey(ResourceManager *resourceManager);
+
+/**
+ * Restores the text tables from the cache. `pItemTable` and `pNPCStats` must be allocated.
+ *
+ * @param cache                         Cache blob, as returned by `saveTextTablesCache`.
+ * @param key                           Expected cache key.
+ * @return                              Whether the tables were restored. If `false` is returned, then the tables
+ *                                      might be left partially overwritten, and should be reset & parsed from scratch.
+ */
+bool loadTextTablesCache(const Blob &cache, uint64_t key);
+
+/**
+ * @param key                           Cache key, as returned by `textTablesCacheKey`.
+ * @return                              Blob with the current state of the text tables.
+ */
+Blob saveTextTablesCache(uint64_t key);
@@ -9,10 +9,8 @@
 IconFrameTable *pIconsFrameTable = nullptr;
 
 int IconFrameTable::animationId(std::string_view animationName) const {
-    for (size_t i = 0; i < _frames.size(); i++)
-        if (ascii::noCaseEquals(animationName, this->_frames[i].animationName))
-            return i;
-    return -1;
+    auto pos = _idByName.find(ascii::toLower(animationName));
+    return pos == _idByName.end() ? -1 : pos->second;
 }
 
 Duration IconFrameTable::animationLength(int animationId) const {
@@ -44,3 +42,10 @@ GraphicsImage *IconFrameTable::loadTexture(int frameId) {
         _textures[frameId] = assets->getImage_ColorKey(_frames[frameId].textureName);
     return _textures[frameId];
 }
+
+void IconFrameTable::buildIndex() {
+    // Lookups are case-insensitive, and the first frame wins, so we store lowercase names & use try_emplace.
+    _idByName.clear();
+    for (size_t i = 0; i < _frames.size(); i++)
+        _idByName.try_emplace(ascii::toLower(_frames[i].animationName), i);
+}
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/Data/IconFrameData.h"
 #include "Engine/Time/Duration.h"
 
+#include "Utility/String/TransparentFunctors.h"
+
 class GraphicsImage;
 class Blob;
 
@@ -19,10 +22,13 @@ class IconFrameTable {
 
  private:
     GraphicsImage *loadTexture(int frameId);
+    void buildIndex();
 
  private:
     std::vector<IconFrameData> _frames;
     std::vector<GraphicsImage *> _textures;
+    // Lowercase name -> index of the first frame with this name.
+    std::unordered_map<TransparentString, int, TransparentStringHash, TransparentStringEquals> _idByName;
 };
 
 extern IconFrameTable *pIconsFrameTable;
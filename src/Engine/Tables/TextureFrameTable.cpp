@@ -12,13 +12,12 @@ TextureFrameTable *pTextureFrameTable;
 
 TextureFrameTable::TextureFrameTable(std::vector<TextureFrameData> frames) : _frames(std::move(frames)) {
     _textures.resize(_frames.size());
+    buildIndex();
 }
 
 int TextureFrameTable::animationId(std::string_view textureName) {
-    for (size_t i = 0; i < _frames.size(); i++)
-        if (ascii::noCaseEquals(textureName, this->_frames[i].textureName))
-            return i;
-    return -1;
+    auto pos = _idByName.find(ascii::toLower(textureName));
+    return pos == _idByName.end() ? -1 : pos->second;
 }
 
 Duration TextureFrameTable::animationLength(int animationId) {
@@ -54,3 +53,10 @@ GraphicsImage *TextureFrameTable::loadTexture(int frameId) {
         _textures[frameId] = assets->getBitmap(_frames[frameId].textureName);
     return _textures[frameId];
 }
+
+void TextureFrameTable::buildIndex() {
+    // Lookups are case-insensitive, and the first frame wins, so we store lowercase names & use try_emplace.
+    _idByName.clear();
+    for (size_t i = 0; i < _frames.size(); i++)
+        _idByName.try_emplace(ascii::toLower(_frames[i].textureName), i);
+}
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/Data/TextureFrameData.h"
 
+#include "Utility/String/TransparentFunctors.h"
+
 class GraphicsImage;
 class Blob;
 
@@ -34,10 +37,13 @@ class TextureFrameTable {
 
  private:
     GraphicsImage *loadTexture(int frameId);
+    void buildIndex();
 
  private:
     std::vector<TextureFrameData> _frames;
     std::vector<GraphicsImage *> _textures;
+    // Lowercase name -> index of the first frame with this name.
+    std::unordered_map<TransparentString, int, TransparentStringHash, TransparentStringEquals> _idByName;
 };
 
 extern TextureFrameTable *pTextureFrameTable;
@@ -0,0 +1,98 @@
+#include "ColorKernels.h"
+
+#include <cassert>
+#include <cfloat>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+
+namespace {
+
+constexpr size_t BLOCK_SIZE = 64;
+
+/**
+ * Branch-free select. Plain ternaries are not enough here, as gcc is eager to turn chains of them back into
+ * control flow, which then prevents vectorization.
+ */
+inline float select(bool condition, float a, float b) {
+    uint32_t mask = -static_cast<uint32_t>(condition);
+    return std::bit_cast<float>((std::bit_cast<uint32_t>(a) & mask) | (std::bit_cast<uint32_t>(b) & ~mask));
+}
+
+/**
+ * Adjusts a single block of colors. Every step below mirrors the corresponding step of `Colorf::toHsvColorf`,
+ * `HsvColorf::adjusted` and `HsvColorf::toColorf`, with branches replaced by selects. Floating point operations are
+ * kept the same so that the results are bit-identical.
+ */
+void adjustBlock(Color *colors, size_t size, float xs, float xv) {
+    assert(size <= BLOCK_SIZE);
+
+    float r[BLOCK_SIZE], g[BLOCK_SIZE], b[BLOCK_SIZE];
+    for (size_t i = 0; i < size; i++) {
+        r[i] = colors[i].r / 255.0f;
+        g[i] = colors[i].g / 255.0f;
+        b[i] = colors[i].b / 255.0f;
+    }
+
+    // RGB -> HSV, then adjust.
+    float h[BLOCK_SIZE], s[BLOCK_SIZE], v[BLOCK_SIZE];
+    for (size_t i = 0; i < size; i++) {
+        float rr = r[i], gg = g[i], bb = b[i];
+        float max = std::max(std::max(rr, gg), bb);
+        float min = std::min(std::min(rr, gg), bb);
+        float delta = max - min;
+
+        // Divisors are clamped away from zero so that the divisions can be done unconditionally. Non-zero divisors are
+        // at least 1/255, and thus are not affected. If max is zero, then so is delta, and saturation is zero as it
+        // should be. If delta is zero, then max == r and the numerator is zero, so hue is zero too.
+        float saturation = delta / std::max(max, FLT_MIN);
+        bool isR = max == rr;
+        bool isG = max == gg;
+        float minuend = select(isR, gg, select(isG, bb, rr));
+        float subtrahend = select(isR, bb, select(isG, rr, gg));
+        float offset = select(isR, 0.0f, select(isG, 2.0f, 4.0f));
+        float hue = ((minuend - subtrahend) / std::max(delta, FLT_MIN) + offset) * 60.0f;
+        hue += select(hue < 0.0f, 360.0f, 0.0f);
+
+        // Hue is in [0, 360], so `fmod(hue + 360, 360)` in `adjusted` is just a subtraction, except for 360 that turns
+        // into 0. Which in turn is then handled by `toColorf`.
+        hue = (hue + 360.0f) - 360.0f;
+        h[i] = select(hue == 360.0f, 0.0f, hue);
+        s[i] = std::clamp(saturation * xs, 0.0f, 1.0f);
+        v[i] = std::clamp(max * xv, 0.0f, 1.0f);
+    }
+
+    // HSV -> RGB. Zero saturation doesn't need special handling as p, q and t all turn into v.
+    for (size_t i = 0; i < size; i++) {
+        float ss = s[i], vv = v[i];
+        float hh = h[i] / 60;
+        int segment = static_cast<int>(hh);
+        float fraction = hh - segment;
+        float p = (1.0f - ss) * vv;
+        float q = (1.0f - fraction * ss) * vv;
+        float t = (1.0f - (1.0f - fraction) * ss) * vv;
+
+        // In each segment one of the channels is set to v, one to p, and the remaining one to q in odd segments and
+        // to t in even ones. Same as in `toColorf`, segments past 5 are treated as 5.
+        float x = select(segment % 2 == 1, q, t);
+        r[i] = select((segment == 0) | (segment >= 5), vv, select((segment == 1) | (segment == 4), x, p));
+        g[i] = select((segment == 1) | (segment == 2), vv, select((segment == 0) | (segment == 3), x, p));
+        b[i] = select((segment == 3) | (segment == 4), vv, select((segment == 2) | (segment >= 5), x, p));
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        colors[i].r = r[i] * 255.0f + 0.5f;
+        colors[i].g = g[i] * 255.0f + 0.5f;
+        colors[i].b = b[i] * 255.0f + 0.5f;
+    }
+}
+
+} // namespace
+
+void adjustColors(std::span<Color> colors, float xs, float xv) {
+    assert(xs >= 0.0f);
+    assert(xv >= 0.0f);
+
+    for (size_t pos = 0; pos < colors.size(); pos += BLOCK_SIZE)
+        adjustBlock(colors.data() + pos, std::min(BLOCK_SIZE, colors.size() - pos), xs, xv);
+}
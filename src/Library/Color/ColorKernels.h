@@ -0,0 +1,17 @@
+#pragma once
+
+#include <span>
+
+#include "Color.h"
+
+/**
+ * Performs a hue-preserving saturation-value adjustment of a batch of colors. Produces the same results as calling
+ * `color.toHsvColorf().adjusted(0, xs, xv).toColor()` for each color, but does all of the conversions in a
+ * branch-free manner on blocks of colors, so that the compiler can vectorize them.
+ *
+ * @param colors                        Colors to adjust, in place.
+ * @param xs                            Saturation multiplier, must be non-negative.
+ * @param xv                            Value multiplier, must be non-negative.
+ * @see HsvColorf::adjusted
+ */
+void adjustColors(std::span<Color> colors, float xs, float xv);
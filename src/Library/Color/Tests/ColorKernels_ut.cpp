@@ -0,0 +1,35 @@
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Color/ColorKernels.h"
+#include "Library/Color/HsvColorf.h"
+
+UNIT_TEST(ColorKernels, AdjustColors) {
+    // Sparse RGB cube, with some extra colors around the hue segment boundaries & the greys. Size is not a multiple
+    // of the block size.
+    std::vector<Color> colors;
+    for (int r = 0; r < 256; r += 5)
+        for (int g = 0; g < 256; g += 5)
+            for (int b = 0; b < 256; b += 5)
+                colors.emplace_back(r, g, b, (r + g + b) % 256);
+    for (int i = 0; i < 256; i++) {
+        colors.emplace_back(i, i, i);
+        colors.emplace_back(255, i, 0);
+        colors.emplace_back(i, 255, 0);
+        colors.emplace_back(0, 255, i);
+        colors.emplace_back(0, i, 255);
+        colors.emplace_back(i, 0, 255);
+        colors.emplace_back(255, 0, i);
+    }
+
+    std::vector<std::pair<float, float>> multipliers = {{1.0f, 1.0f}, {0.65f, 1.1f}, {0.0f, 0.5f}, {2.0f, 3.0f}};
+    for (auto [xs, xv] : multipliers) {
+        std::vector<Color> adjusted = colors;
+        adjustColors(adjusted, xs, xv);
+
+        for (size_t i = 0; i < colors.size(); i++)
+            EXPECT_EQ(adjusted[i], colors[i].toHsvColorf().adjusted(0, xs, xv).toColor());
+    }
+}
@@ -2,44 +2,353 @@
 
 #include <zlib.h>
 
+#include <cassert>
+#include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <new>
+#include <vector>
 
+#include "Utility/Concurrency/ThreadPool.h"
 #include "Utility/Memory/FreeDeleter.h"
+#include "Utility/Streams/InputStream.h"
+#include "Utility/Streams/OutputStream.h"
+#include "Utility/Exception.h"
 
 namespace zlib {
 
+namespace {
+
+constexpr size_t STREAM_BUFFER_SIZE = 64 * 1024;
+constexpr size_t WINDOW_SIZE = 32 * 1024;
+constexpr size_t MAX_ZLIB_CHUNK = std::numeric_limits<uInt>::max(); // zlib takes sizes as uInt.
+
+[[noreturn]] void throwZlibError(const z_stream &stream, int code) {
+    throw Exception("Zlib error {}: {}", code, stream.msg ? stream.msg : zError(code));
+}
+
+/**
+ * RAII wrapper for a zlib deflate stream.
+ */
+class Deflater {
+ public:
+    /**
+     * @param windowBits                Window bits as accepted by `deflateInit2`, negative values produce raw deflate
+     *                                  streams without zlib header & trailer.
+     */
+    explicit Deflater(int windowBits = MAX_WBITS) {
+        int res = deflateInit2(&_stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY);
+        if (res != Z_OK)
+            throwZlibError(_stream, res);
+    }
+
+    ~Deflater() {
+        deflateEnd(&_stream);
+    }
+
+    z_stream *operator->() {
+        return &_stream;
+    }
+
+    z_stream *get() {
+        return &_stream;
+    }
+
+ private:
+    z_stream _stream = {};
+};
+
+/**
+ * RAII wrapper for a zlib inflate stream.
+ */
+class Inflater {
+ public:
+    Inflater() {
+        int res = inflateInit(&_stream);
+        if (res != Z_OK)
+            throwZlibError(_stream, res);
+    }
+
+    ~Inflater() {
+        inflateEnd(&_stream);
+    }
+
+    z_stream *operator->() {
+        return &_stream;
+    }
+
+    z_stream *get() {
+        return &_stream;
+    }
+
+ private:
+    z_stream _stream = {};
+};
+
+/**
+ * Growable `malloc`-backed buffer that can be turned into a `Blob` without copying.
+ */
+class MallocBuffer {
+ public:
+    explicit MallocBuffer(size_t capacity) {
+        reserve(std::max<size_t>(capacity, 1));
+    }
+
+    void reserve(size_t capacity) {
+        if (capacity <= _capacity)
+            return;
+
+        void *data = std::realloc(_data.get(), capacity);
+        if (!data)
+            throw std::bad_alloc();
+        _data.release();
+        _data.reset(data);
+        _capacity = capacity;
+    }
+
+    [[nodiscard]] unsigned char *data() const {
+        return static_cast<unsigned char *>(_data.get());
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return _capacity;
+    }
+
+    [[nodiscard]] Blob release(size_t size) {
+        assert(size <= _capacity);
+
+        // Shrinking realloc is cheap, and it doesn't make sense to keep the slack around.
+        if (size != 0 && size != _capacity) {
+            if (void *data = std::realloc(_data.get(), size)) {
+                _data.release();
+                _data.reset(data);
+            }
+        }
+
+        _capacity = 0;
+        return Blob::fromMalloc(std::move(_data), size);
+    }
+
+ private:
+    std::unique_ptr<void, FreeDeleter> _data;
+    size_t _capacity = 0;
+};
+
+/**
+ * Deflates the provided data into a buffer, growing the buffer if needed.
+ *
+ * @param deflater                      Deflate stream to use.
+ * @param data                          Data to compress.
+ * @param size                          Size of the data.
+ * @param flush                         Flush mode for the last call to `deflate`.
+ * @param buffer                        Output buffer.
+ * @param outputSize                    Number of bytes in the output buffer, updated by this function.
+ */
+void deflateInto(Deflater &deflater, const unsigned char *data, size_t size, int flush, MallocBuffer *buffer,
+                 size_t *outputSize) {
+    size_t inputPos = 0;
+    while (true) {
+        size_t inputChunk = std::min(size - inputPos, MAX_ZLIB_CHUNK);
+        deflater->next_in = const_cast<Bytef *>(data + inputPos);
+        deflater->avail_in = inputChunk;
+
+        if (*outputSize == buffer->capacity())
+            buffer->reserve(buffer->capacity() * 2);
+        size_t outputChunk = std::min(buffer->capacity() - *outputSize, MAX_ZLIB_CHUNK);
+        deflater->next_out = buffer->data() + *outputSize;
+        deflater->avail_out = outputChunk;
+
+        bool lastInput = inputPos + inputChunk == size;
+        int res = deflate(deflater.get(), lastInput ? flush : Z_NO_FLUSH);
+        if (res != Z_OK && res != Z_STREAM_END && res != Z_BUF_ERROR)
+            throwZlibError(*deflater.get(), res);
+
+        inputPos += inputChunk - deflater->avail_in;
+        *outputSize += outputChunk - deflater->avail_out;
+
+        if (res == Z_STREAM_END)
+            return;
+        if (lastInput && deflater->avail_in == 0 && deflater->avail_out != 0 && flush != Z_FINISH)
+            return; // All input consumed & flushed.
+    }
+}
+
+} // namespace
+
 Blob compress(const Blob &source) {
-    uLongf destLen = source.size();
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
+    Deflater deflater;
+    MallocBuffer buffer(deflateBound(deflater.get(), source.size()));
+    size_t size = 0;
+    deflateInto(deflater, static_cast<const unsigned char *>(source.data()), source.size(), Z_FINISH, &buffer, &size);
+    return buffer.release(size);
+}
+
+Blob compress(const Blob &source, ThreadPool *pool, size_t chunkSize) {
+    assert(pool && chunkSize > 0);
+
+    size_t chunkCount = std::max<size_t>(1, (source.size() + chunkSize - 1) / chunkSize);
+    if (chunkCount == 1)
+        return compress(source);
+
+    const unsigned char *data = static_cast<const unsigned char *>(source.data());
+
+    struct Chunk {
+        Blob compressed;
+        uLong adler = 0;
+        size_t size = 0;
+    };
+    std::vector<Chunk> chunks(chunkCount);
+
+    pool->parallelFor(chunkCount, [&](size_t i) {
+        size_t offset = i * chunkSize;
+        size_t size = std::min(chunkSize, source.size() - offset);
+        bool last = i + 1 == chunkCount;
+
+        // Raw deflate, zlib header & trailer are written below.
+        Deflater deflater(-MAX_WBITS);
+        if (i > 0) {
+            size_t dictionarySize = std::min(offset, WINDOW_SIZE);
+            int res = deflateSetDictionary(deflater.get(), data + offset - dictionarySize, dictionarySize);
+            if (res != Z_OK)
+                throwZlibError(*deflater.get(), res);
         }
-        dest.reset(malloc(destLen));
-        res = ::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+
+        // Z_SYNC_FLUSH makes the chunk end on a byte boundary w/o marking the last block as final, so that chunks
+        // can be just concatenated.
+        MallocBuffer buffer(deflateBound(deflater.get(), size) + 16);
+        size_t outputSize = 0;
+        deflateInto(deflater, data + offset, size, last ? Z_FINISH : Z_SYNC_FLUSH, &buffer, &outputSize);
+
+        chunks[i].compressed = buffer.release(outputSize);
+        chunks[i].adler = adler32(adler32(0, nullptr, 0), data + offset, size);
+        chunks[i].size = size;
+    });
+
+    uLong adler = chunks[0].adler;
+    size_t totalSize = 2 + 4; // Zlib header & trailer.
+    for (size_t i = 0; i < chunkCount; i++) {
+        if (i > 0)
+            adler = adler32_combine(adler, chunks[i].adler, chunks[i].size);
+        totalSize += chunks[i].compressed.size();
+    }
+
+    MallocBuffer buffer(totalSize);
+    unsigned char *pos = buffer.data();
+
+    // Header for deflate with a 32K window & default compression level, same as what deflate writes.
+    *pos++ = 0x78;
+    *pos++ = 0x9C;
+    for (const Chunk &chunk : chunks) {
+        memcpy(pos, chunk.compressed.data(), chunk.compressed.size());
+        pos += chunk.compressed.size();
     }
+    *pos++ = (adler >> 24) & 0xFF;
+    *pos++ = (adler >> 16) & 0xFF;
+    *pos++ = (adler >> 8) & 0xFF;
+    *pos++ = adler & 0xFF;
 
-    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+    return buffer.release(totalSize);
 }
 
 Blob uncompress(const Blob &source, size_t sizeHint) {
-    uLongf destLen = sizeHint > source.size() ? sizeHint : source.size() * 4;
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
+    const unsigned char *data = static_cast<const unsigned char *>(source.data());
+
+    Inflater inflater;
+    MallocBuffer buffer(sizeHint ? sizeHint : source.size() * 4);
+    size_t inputPos = 0;
+    size_t outputSize = 0;
+    while (true) {
+        size_t inputChunk = std::min(source.size() - inputPos, MAX_ZLIB_CHUNK);
+        inflater->next_in = const_cast<Bytef *>(data + inputPos);
+        inflater->avail_in = inputChunk;
+
+        size_t outputChunk = std::min(buffer.capacity() - outputSize, MAX_ZLIB_CHUNK);
+        inflater->next_out = buffer.data() + outputSize;
+        inflater->avail_out = outputChunk;
+
+        int res = inflate(inflater.get(), Z_NO_FLUSH);
+        inputPos += inputChunk - inflater->avail_in;
+        outputSize += outputChunk - inflater->avail_out;
+
+        if (res == Z_STREAM_END)
+            break;
+
+        if (res == Z_BUF_ERROR) {
+            if (inflater->avail_out != 0)
+                throw Exception("Zlib stream '{}' is truncated", source.displayPath());
+
+            // Grow & continue, no need to restart.
+            buffer.reserve(buffer.capacity() * 2);
+        } else if (res != Z_OK) {
+            throwZlibError(*inflater.get(), res);
+        }
+    }
+
+    return buffer.release(outputSize);
+}
+
+void compress(InputStream *src, OutputStream *dst) {
+    assert(src && dst);
+
+    Deflater deflater;
+    std::unique_ptr<unsigned char[]> input = std::make_unique<unsigned char[]>(STREAM_BUFFER_SIZE);
+    std::unique_ptr<unsigned char[]> output = std::make_unique<unsigned char[]>(STREAM_BUFFER_SIZE);
+
+    int flush = Z_NO_FLUSH;
+    while (true) {
+        if (deflater->avail_in == 0 && flush == Z_NO_FLUSH) {
+            size_t bytesRead = src->read(input.get(), STREAM_BUFFER_SIZE);
+            deflater->next_in = input.get();
+            deflater->avail_in = bytesRead;
+            if (bytesRead == 0)
+                flush = Z_FINISH;
         }
-        dest.reset(malloc(destLen));
-        res = ::uncompress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+
+        deflater->next_out = output.get();
+        deflater->avail_out = STREAM_BUFFER_SIZE;
+        int res = deflate(deflater.get(), flush);
+        if (res != Z_OK && res != Z_STREAM_END && res != Z_BUF_ERROR)
+            throwZlibError(*deflater.get(), res);
+
+        dst->write(output.get(), STREAM_BUFFER_SIZE - deflater->avail_out);
+
+        if (res == Z_STREAM_END)
+            return;
     }
+}
+
+void uncompress(InputStream *src, OutputStream *dst) {
+    assert(src && dst);
+
+    Inflater inflater;
+    std::unique_ptr<unsigned char[]> input = std::make_unique<unsigned char[]>(STREAM_BUFFER_SIZE);
+    std::unique_ptr<unsigned char[]> output = std::make_unique<unsigned char[]>(STREAM_BUFFER_SIZE);
 
-    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+    bool inputExhausted = false;
+    while (true) {
+        if (inflater->avail_in == 0 && !inputExhausted) {
+            size_t bytesRead = src->read(input.get(), STREAM_BUFFER_SIZE);
+            inflater->next_in = input.get();
+            inflater->avail_in = bytesRead;
+            inputExhausted = bytesRead == 0;
+        }
+
+        inflater->next_out = output.get();
+        inflater->avail_out = STREAM_BUFFER_SIZE;
+        int res = inflate(inflater.get(), Z_NO_FLUSH);
+        if (res != Z_OK && res != Z_STREAM_END && res != Z_BUF_ERROR)
+            throwZlibError(*inflater.get(), res);
+
+        size_t produced = STREAM_BUFFER_SIZE - inflater->avail_out;
+        dst->write(output.get(), produced);
+
+        if (res == Z_STREAM_END)
+            return;
+        if (res == Z_BUF_ERROR && inputExhausted)
+            throw Exception("Zlib stream '{}' is truncated", src->displayPath());
+    }
 }
 
 };  // namespace zlib
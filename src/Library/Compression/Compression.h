@@ -1,8 +1,70 @@
 #pragma once
 
+#include <cstddef>
+
 #include "Utility/Memory/Blob.h"
 
+class InputStream;
+class OutputStream;
+class ThreadPool;
+
 namespace zlib {
+
+/**
+ * Default chunk size for parallel compression. Chunks that are too small hurt the compression ratio, so there's
+ * little point in going lower than this.
+ */
+constexpr size_t DEFAULT_CHUNK_SIZE = 128 * 1024;
+
+/**
+ * @param source                        Data to compress.
+ * @return                              Zlib stream containing the compressed data.
+ * @throws Exception                    On zlib errors.
+ */
 Blob compress(const Blob &source);
+
+/**
+ * Parallel version of `compress`. Splits the source into chunks and compresses them independently on the provided
+ * thread pool, priming each chunk with the tail of the previous one, pretty much like `pigz` does. The result is a
+ * single regular zlib stream, so it can be decompressed with `uncompress` or any other zlib decoder.
+ *
+ * Output depends only on the source data and the chunk size, and not on the number of threads in the pool.
+ *
+ * @param source                        Data to compress.
+ * @param pool                          Thread pool to use.
+ * @param chunkSize                     Size of a single chunk, in bytes.
+ * @return                              Zlib stream containing the compressed data.
+ * @throws Exception                    On zlib errors.
+ */
+Blob compress(const Blob &source, ThreadPool *pool, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+/**
+ * @param source                        Zlib stream to decompress.
+ * @param sizeHint                      Expected size of the decompressed data. If it's correct, then the output
+ *                                      buffer is allocated exactly once. Otherwise it's grown as needed, without
+ *                                      restarting the decompression.
+ * @return                              Decompressed data.
+ * @throws Exception                    If the source is not a valid zlib stream, or if it's truncated.
+ */
 Blob uncompress(const Blob &source, size_t sizeHint = 0);
+
+/**
+ * Streaming version of `compress`. Reads the source stream until it's exhausted.
+ *
+ * @param src                           Stream to read the data to compress from.
+ * @param dst                           Stream to write the zlib stream into.
+ * @throws Exception                    On zlib errors, or on IO errors in the provided streams.
+ */
+void compress(InputStream *src, OutputStream *dst);
+
+/**
+ * Streaming version of `uncompress`. Data that follows the end of the zlib stream is ignored.
+ *
+ * @param src                           Stream to read the zlib stream from.
+ * @param dst                           Stream to write the decompressed data into.
+ * @throws Exception                    If the source is not a valid zlib stream, if it's truncated, or on IO errors in
+ *                                      the provided streams.
+ */
+void uncompress(InputStream *src, OutputStream *dst);
+
 };  // namespace zlib
@@ -0,0 +1,104 @@
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Compression/Compression.h"
+
+#include "Utility/Concurrency/ThreadPool.h"
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/Streams/MemoryInputStream.h"
+#include "Utility/Exception.h"
+
+static Blob makeTestData(size_t size) {
+    std::string result;
+    result.reserve(size);
+    uint32_t state = 12345;
+    while (result.size() < size) {
+        state = state * 1103515245 + 12345;
+        // Mix of repeating text & noise, so that it's compressible, but not trivially.
+        if ((state >> 16) % 4 == 0) {
+            result += static_cast<char>(state >> 24);
+        } else {
+            result += "the quick brown fox jumps over the lazy dog ";
+        }
+    }
+    result.resize(size);
+    return Blob::fromString(std::move(result));
+}
+
+static bool equal(const Blob &l, const Blob &r) {
+    return l.string_view() == r.string_view();
+}
+
+UNIT_TEST(Compression, RoundTrip) {
+    for (size_t size : {0, 1, 100, 100000}) {
+        Blob data = makeTestData(size);
+        Blob compressed = zlib::compress(data);
+        EXPECT_TRUE(equal(zlib::uncompress(compressed, size), data));
+        EXPECT_TRUE(equal(zlib::uncompress(compressed), data)); // Output buffer will have to grow.
+        EXPECT_TRUE(equal(zlib::uncompress(compressed, 1), data));
+    }
+}
+
+UNIT_TEST(Compression, ParallelRoundTrip) {
+    Blob data = makeTestData(1000000);
+
+    std::optional<Blob> reference;
+    for (int threads : {0, 1, 4}) {
+        ThreadPool pool(threads);
+        for (size_t chunkSize : {size_t(1000), zlib::DEFAULT_CHUNK_SIZE, size_t(2000000)})
+            EXPECT_TRUE(equal(zlib::uncompress(zlib::compress(data, &pool, chunkSize), data.size()), data));
+
+        // Output shouldn't depend on the number of threads.
+        Blob compressed = zlib::compress(data, &pool);
+        if (!reference)
+            reference = Blob::share(compressed);
+        EXPECT_TRUE(equal(compressed, *reference));
+    }
+
+    // Single chunk is the same as serial compression.
+    ThreadPool pool(2);
+    EXPECT_TRUE(equal(zlib::compress(data, &pool, data.size()), zlib::compress(data)));
+}
+
+UNIT_TEST(Compression, Streaming) {
+    Blob data = makeTestData(300000);
+
+    Blob compressed;
+    {
+        MemoryInputStream input(data.data(), data.size());
+        BlobOutputStream output(&compressed);
+        zlib::compress(&input, &output);
+        output.close();
+    }
+    EXPECT_TRUE(equal(compressed, zlib::compress(data)));
+
+    Blob uncompressed;
+    {
+        MemoryInputStream input(compressed.data(), compressed.size());
+        BlobOutputStream output(&uncompressed);
+        zlib::uncompress(&input, &output);
+        output.close();
+    }
+    EXPECT_TRUE(equal(uncompressed, data));
+}
+
+UNIT_TEST(Compression, Truncated) {
+    Blob data = makeTestData(10000);
+    Blob compressed = zlib::compress(data);
+    Blob truncated = compressed.subBlob(0, compressed.size() / 2);
+
+    EXPECT_THROW((void) zlib::uncompress(truncated, data.size()), Exception);
+
+    MemoryInputStream input(truncated.data(), truncated.size());
+    Blob uncompressed;
+    BlobOutputStream output(&uncompressed);
+    EXPECT_THROW(zlib::uncompress(&input, &output), Exception);
+}
+
+UNIT_TEST(Compression, Garbage) {
+    Blob data = makeTestData(10000);
+    EXPECT_THROW((void) zlib::uncompress(data), Exception);
+}
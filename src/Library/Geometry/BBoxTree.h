@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "BBox.h"
+
+/**
+ * Static bounding volume hierarchy over a set of axis-aligned bounding boxes.
+ *
+ * The tree is stored in flat arrays, nodes in depth-first order and leaf boxes & ids in leaf order, so querying it
+ * doesn't allocate and touches memory mostly sequentially.
+ *
+ * Note that unlike `SpatialGrid`, the order in which ids are reported from a query is unspecified. Callers that
+ * depend on the visiting order should sort the results.
+ */
+template<class T>
+class BBoxTree {
+ public:
+    BBoxTree() = default;
+
+    /**
+     * Rebuilds the tree.
+     *
+     * @param boxes                     Boxes to index, `i`-th box gets id `i`.
+     */
+    void build(std::span<const BBox<T>> boxes) {
+        clear();
+        if (boxes.empty())
+            return;
+
+        _ids.resize(boxes.size());
+        std::iota(_ids.begin(), _ids.end(), 0);
+        _nodes.reserve(2 * boxes.size() / LEAF_SIZE + 1);
+        buildNode(boxes, 0, _ids.size());
+
+        _boxes.reserve(_ids.size());
+        for (int id : _ids)
+            _boxes.push_back(boxes[id]);
+    }
+
+    void clear() {
+        _nodes.clear();
+        _boxes.clear();
+        _ids.clear();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _nodes.empty();
+    }
+
+    /**
+     * @return                          Bounds of all the boxes in this tree. Must not be called on an empty tree.
+     */
+    [[nodiscard]] const BBox<T> &bounds() const {
+        assert(!empty());
+        return _nodes[0].bounds;
+    }
+
+    /**
+     * Calls the provided callback for the ids of all boxes that intersect the provided box, in unspecified order.
+     *
+     * @param box                       Box to check against, see `BBox::intersects` for the exact semantics.
+     * @param callback                  Callback to invoke, takes a single `int` argument.
+     */
+    template<class Callback>
+    void forEachIntersecting(const BBox<T> &box, Callback &&callback) const {
+        if (_nodes.empty())
+            return;
+
+        int stack[MAX_DEPTH];
+        int stackSize = 0;
+        stack[stackSize++] = 0;
+        while (stackSize > 0) {
+            int index = stack[--stackSize];
+            const Node &node = _nodes[index];
+            if (!node.bounds.intersects(box))
+                continue;
+
+            if (node.count > 0) {
+                for (int i = node.first; i < node.first + node.count; i++)
+                    if (_boxes[i].intersects(box))
+                        callback(_ids[i]);
+            } else {
+                assert(stackSize + 2 <= MAX_DEPTH);
+                stack[stackSize++] = node.first; // Right child.
+                stack[stackSize++] = index + 1; // Left child.
+            }
+        }
+    }
+
+ private:
+    static constexpr int LEAF_SIZE = 4;
+    static constexpr int MAX_DEPTH = 64;
+
+    struct Node {
+        BBox<T> bounds;
+        int first = 0; // First id index for leaves, right child index for inner nodes. Left child always follows parent.
+        int count = 0; // Number of ids for leaves, zero for inner nodes.
+    };
+
+    int buildNode(std::span<const BBox<T>> boxes, size_t begin, size_t end) {
+        int index = _nodes.size();
+        _nodes.emplace_back();
+
+        BBox<T> bounds = boxes[_ids[begin]];
+        for (size_t i = begin + 1; i < end; i++)
+            bounds = bounds | boxes[_ids[i]];
+        _nodes[index].bounds = bounds;
+
+        if (end - begin <= LEAF_SIZE) {
+            _nodes[index].first = begin;
+            _nodes[index].count = end - begin;
+            return index;
+        }
+
+        // Median split along the longest axis of the node bounds. Box centers are compared doubled to stay exact for
+        // integer boxes.
+        Vec3<T> size = bounds.size();
+        int axis = size.x >= size.y && size.x >= size.z ? 0 : size.y >= size.z ? 1 : 2;
+        auto center2 = [&](int id) {
+            const BBox<T> &box = boxes[id];
+            return axis == 0 ? box.x1 + box.x2 : axis == 1 ? box.y1 + box.y2 : box.z1 + box.z2;
+        };
+
+        size_t middle = begin + (end - begin) / 2;
+        std::nth_element(_ids.begin() + begin, _ids.begin() + middle, _ids.begin() + end, [&](int l, int r) {
+            return center2(l) < center2(r);
+        });
+
+        buildNode(boxes, begin, middle);
+        int right = buildNode(boxes, middle, end);
+        _nodes[index].first = right;
+        return index;
+    }
+
+ private:
+    std::vector<Node> _nodes;
+    std::vector<BBox<T>> _boxes;
+    std::vector<int> _ids;
+};
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "BBox.h"
+
+/**
+ * Uniform 2D grid over the XY plane that maps bounding boxes to integer ids. Meant to be used as a broad-phase
+ * filter for point queries.
+ *
+ * Ids are indices into the range of boxes that the grid was built from, and inside each cell they are stored in
+ * ascending order. This means that iterating over the candidates for a point visits them in the same order as a
+ * linear scan over the source boxes would, so replacing a linear scan with a grid lookup doesn't change the results
+ * of the order-dependent code that follows.
+ *
+ * The grid is conservative: every box whose XY projection contains the query point is returned, but some other boxes
+ * can be returned too. Callers are expected to run the exact test on the candidates.
+ */
+template<class T>
+class SpatialGrid {
+ public:
+    SpatialGrid() = default;
+
+    /**
+     * Rebuilds the grid.
+     *
+     * @param boxes                     Boxes to index, `i`-th box gets id `i`.
+     * @param cellSize                  Size of a single grid cell. The number of cells along each axis is capped at
+     *                                  `maxCellsPerAxis`, so the actual cell size might end up being larger.
+     * @param maxCellsPerAxis           Upper bound on the number of cells along each axis.
+     */
+    void build(std::span<const BBox<T>> boxes, T cellSize, int maxCellsPerAxis = 256) {
+        assert(cellSize > 0 && maxCellsPerAxis > 0);
+
+        clear();
+        if (boxes.empty())
+            return;
+
+        BBox<T> bounds = boxes[0];
+        for (const BBox<T> &box : boxes)
+            bounds = bounds | box;
+
+        _x0 = bounds.x1;
+        _y0 = bounds.y1;
+        _x1 = bounds.x2;
+        _y1 = bounds.y2;
+        _cellSize = std::max(cellSize, static_cast<T>(std::max(_x1 - _x0, _y1 - _y0) / maxCellsPerAxis));
+        _width = std::clamp(static_cast<int>((_x1 - _x0) / _cellSize) + 1, 1, maxCellsPerAxis);
+        _height = std::clamp(static_cast<int>((_y1 - _y0) / _cellSize) + 1, 1, maxCellsPerAxis);
+
+        // Counting sort into cells. Two passes, first one counts the ids per cell, second one fills them in. Boxes are
+        // processed in order in both passes, so ids inside each cell end up sorted.
+        _offsets.assign(_width * _height + 1, 0);
+        forEachCell(boxes, [&](int cell, int) { _offsets[cell + 1]++; });
+        for (size_t i = 1; i < _offsets.size(); i++)
+            _offsets[i] += _offsets[i - 1];
+
+        std::vector<int> positions(_offsets.begin(), _offsets.end() - 1);
+        _ids.resize(_offsets.back());
+        forEachCell(boxes, [&](int cell, int id) { _ids[positions[cell]++] = id; });
+    }
+
+    void clear() {
+        _offsets.clear();
+        _ids.clear();
+        _width = _height = 0;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _offsets.empty();
+    }
+
+    /**
+     * @param x                         X coordinate of the query point.
+     * @param y                         Y coordinate of the query point.
+     * @return                          Sorted ids of the boxes that might contain the provided point in their XY
+     *                                  projection. Empty span is returned for points outside the grid.
+     */
+    [[nodiscard]] std::span<const int> candidates(T x, T y) const {
+        if (_offsets.empty())
+            return {};
+
+        // Written this way so that NaNs are rejected too.
+        if (!(x >= _x0 && x <= _x1 && y >= _y0 && y <= _y1))
+            return {};
+
+        int cell = cellY(y) * _width + cellX(x);
+        return std::span<const int>(_ids.data() + _offsets[cell], _ids.data() + _offsets[cell + 1]);
+    }
+
+ private:
+    [[nodiscard]] int cellX(T x) const {
+        return std::clamp(static_cast<int>(std::floor((x - _x0) / _cellSize)), 0, _width - 1);
+    }
+
+    [[nodiscard]] int cellY(T y) const {
+        return std::clamp(static_cast<int>(std::floor((y - _y0) / _cellSize)), 0, _height - 1);
+    }
+
+    template<class Callback>
+    void forEachCell(std::span<const BBox<T>> boxes, Callback &&callback) const {
+        for (size_t i = 0; i < boxes.size(); i++) {
+            const BBox<T> &box = boxes[i];
+            int cx1 = cellX(box.x1), cx2 = cellX(box.x2);
+            int cy1 = cellY(box.y1), cy2 = cellY(box.y2);
+            for (int cy = cy1; cy <= cy2; cy++)
+                for (int cx = cx1; cx <= cx2; cx++)
+                    callback(cy * _width + cx, static_cast<int>(i));
+        }
+    }
+
+ private:
+    T _x0 = 0;
+    T _y0 = 0;
+    T _x1 = 0;
+    T _y1 = 0;
+    T _cellSize = 1;
+    int _width = 0;
+    int _height = 0;
+    std::vector<int> _offsets; // Cell i holds ids in [_offsets[i], _offsets[i + 1]).
+    std::vector<int> _ids;
+};
@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/BBoxTree.h"
+
+static BBoxf randomBox(std::mt19937 &rng, float maxSize) {
+    std::uniform_real_distribution<float> pos(-1000, 1000);
+    std::uniform_real_distribution<float> size(0, maxSize);
+
+    BBoxf result;
+    result.x1 = pos(rng);
+    result.y1 = pos(rng);
+    result.z1 = pos(rng);
+    result.x2 = result.x1 + size(rng);
+    result.y2 = result.y1 + size(rng);
+    result.z2 = result.z1 + size(rng);
+    return result;
+}
+
+UNIT_TEST(BBoxTree, Empty) {
+    BBoxTree<float> tree;
+    EXPECT_TRUE(tree.empty());
+
+    int count = 0;
+    tree.forEachIntersecting(BBoxf(), [&](int) { count++; });
+    EXPECT_EQ(count, 0);
+}
+
+UNIT_TEST(BBoxTree, MatchesLinearScan) {
+    std::mt19937 rng(42);
+
+    std::vector<BBoxf> boxes;
+    for (int i = 0; i < 1000; i++)
+        boxes.push_back(randomBox(rng, 100));
+
+    BBoxTree<float> tree;
+    tree.build(boxes);
+
+    for (int i = 0; i < 500; i++) {
+        BBoxf query = randomBox(rng, 300);
+
+        std::vector<int> expected;
+        for (size_t j = 0; j < boxes.size(); j++)
+            if (boxes[j].intersects(query))
+                expected.push_back(j);
+
+        std::vector<int> actual;
+        tree.forEachIntersecting(query, [&](int id) { actual.push_back(id); });
+        std::ranges::sort(actual);
+
+        EXPECT_EQ(actual, expected);
+    }
+}
+
+UNIT_TEST(BBoxTree, DegenerateBoxes) {
+    std::vector<BBoxi> boxes(100); // All boxes are the same point.
+
+    BBoxTree<int> tree;
+    tree.build(boxes);
+
+    int count = 0;
+    tree.forEachIntersecting(BBoxi(), [&](int) { count++; });
+    EXPECT_EQ(count, 100);
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Geometry/SpatialGrid.h"
+
+static BBoxf boxXY(float x1, float y1, float x2, float y2) {
+    BBoxf result;
+    result.x1 = x1;
+    result.y1 = y1;
+    result.x2 = x2;
+    result.y2 = y2;
+    return result;
+}
+
+UNIT_TEST(SpatialGrid, Empty) {
+    SpatialGrid<float> grid;
+    EXPECT_TRUE(grid.empty());
+    EXPECT_TRUE(grid.candidates(0, 0).empty());
+
+    grid.build({}, 10);
+    EXPECT_TRUE(grid.empty());
+    EXPECT_TRUE(grid.candidates(0, 0).empty());
+}
+
+UNIT_TEST(SpatialGrid, MatchesLinearScan) {
+    std::vector<BBoxf> boxes = {
+        boxXY(-100, -100, 100, 100),
+        boxXY(0, 0, 10, 10),
+        boxXY(-50, 20, -40, 90),
+        boxXY(95, -100, 100, -95),
+        boxXY(-100, -100, 100, 100),
+        boxXY(33.5f, 33.5f, 33.5f, 33.5f)
+    };
+
+    SpatialGrid<float> grid;
+    grid.build(boxes, 7);
+
+    for (float y = -110; y <= 110; y += 0.5f) {
+        for (float x = -110; x <= 110; x += 0.5f) {
+            std::vector<int> expected;
+            for (size_t i = 0; i < boxes.size(); i++)
+                if (boxes[i].containsXY(x, y))
+                    expected.push_back(i);
+
+            std::vector<int> actual;
+            for (int id : grid.candidates(x, y))
+                if (boxes[id].containsXY(x, y))
+                    actual.push_back(id);
+
+            EXPECT_EQ(actual, expected) << "x = " << x << ", y = " << y;
+        }
+    }
+}
+
+UNIT_TEST(SpatialGrid, CandidatesSorted) {
+    std::vector<BBoxf> boxes(50, boxXY(0, 0, 1000, 1000));
+
+    SpatialGrid<float> grid;
+    grid.build(boxes, 1);
+
+    auto candidates = grid.candidates(500, 500);
+    EXPECT_EQ(candidates.size(), boxes.size());
+    EXPECT_TRUE(std::ranges::is_sorted(candidates));
+}
+
+UNIT_TEST(SpatialGrid, OutsideAndNan) {
+    std::vector<BBoxf> boxes = {boxXY(0, 0, 10, 10)};
+
+    SpatialGrid<float> grid;
+    grid.build(boxes, 1);
+
+    EXPECT_TRUE(grid.candidates(-1, 5).empty());
+    EXPECT_TRUE(grid.candidates(5, 11).empty());
+    EXPECT_TRUE(grid.candidates(NAN, 5).empty());
+    EXPECT_EQ(grid.candidates(10, 10).size(), 1);
+}
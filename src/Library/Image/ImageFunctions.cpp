@@ -2,18 +2,14 @@
 
 #include <cassert>
 
+#include "ImageKernels.h"
+
 RgbaImage makeRgbaImage(GrayscaleImageView indexedImage, const Palette &palette) {
     if (!indexedImage)
         return RgbaImage();
 
     RgbaImage result = RgbaImage::uninitialized(indexedImage.width(), indexedImage.height());
-    auto srcPixels = indexedImage.pixels();
-    auto dstPixels = result.pixels();
-    assert(srcPixels.size() == dstPixels.size());
-
-    for (size_t i = 0, size = srcPixels.size(); i < size; i++)
-        dstPixels[i] = palette.colors[srcPixels[i]];
-
+    expandPalette(indexedImage.pixels(), palette, result.pixels());
     return result;
 }
 
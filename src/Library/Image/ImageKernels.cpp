@@ -0,0 +1,128 @@
+#include "ImageKernels.h"
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+void expandPalette(std::span<const uint8_t> src, const Palette &palette, std::span<Color> dst) {
+    assert(src.size() == dst.size());
+
+    // Going through uint32_t makes it a single load & store per pixel. Unrolling lets the lookups for several pixels
+    // run in parallel.
+    uint32_t table[256];
+    static_assert(sizeof(table) == sizeof(palette.colors));
+    memcpy(table, palette.colors.data(), sizeof(table));
+
+    const uint8_t *in = src.data();
+    uint32_t *out = reinterpret_cast<uint32_t *>(dst.data());
+    size_t size = src.size();
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        uint32_t c0 = table[in[i + 0]];
+        uint32_t c1 = table[in[i + 1]];
+        uint32_t c2 = table[in[i + 2]];
+        uint32_t c3 = table[in[i + 3]];
+        out[i + 0] = c0;
+        out[i + 1] = c1;
+        out[i + 2] = c2;
+        out[i + 3] = c3;
+    }
+    for (; i < size; i++)
+        out[i] = table[in[i]];
+}
+
+void replaceColor(std::span<Color> pixels, Color from, Color to) {
+    uint32_t fromValue = from.c32();
+    uint32_t toValue = to.c32();
+
+    // Branch-free select so that the loop gets vectorized.
+    uint32_t *data = reinterpret_cast<uint32_t *>(pixels.data());
+    for (size_t i = 0, size = pixels.size(); i < size; i++)
+        data[i] = data[i] == fromValue ? toValue : data[i];
+}
+
+void bleedTransparentPixels(GrayscaleImageView indexedImage, const Palette &palette, RgbaImage *image) {
+    assert(image && image->size() == indexedImage.size());
+
+    size_t w = indexedImage.width();
+    size_t h = indexedImage.height();
+    if (w == 0 || h == 0)
+        return;
+
+    // Per-row horizontal 3-pixel sums of r, g, b & non-transparent pixel count. Max value is 3 * 255, and after
+    // the vertical pass it's 9 * 255, so uint16_t is enough.
+    struct RowSums {
+        std::vector<uint16_t> r, g, b, count;
+    };
+
+    // Values for single pixels, padded with zeros on both sides.
+    std::vector<uint16_t> pixelR(w + 2), pixelG(w + 2), pixelB(w + 2), pixelCount(w + 2);
+
+    auto computeRowSums = [&](size_t y, RowSums *sums) {
+        std::span<const uint8_t> row = indexedImage[y];
+        for (size_t x = 0; x < w; x++) {
+            uint8_t index = row[x];
+            Color color = palette.colors[index];
+            uint16_t mask = index != 0 ? 0xFFFF : 0;
+            pixelR[x + 1] = color.r & mask;
+            pixelG[x + 1] = color.g & mask;
+            pixelB[x + 1] = color.b & mask;
+            pixelCount[x + 1] = mask & 1;
+        }
+
+        sums->r.resize(w);
+        sums->g.resize(w);
+        sums->b.resize(w);
+        sums->count.resize(w);
+        for (size_t x = 0; x < w; x++) {
+            sums->r[x] = pixelR[x] + pixelR[x + 1] + pixelR[x + 2];
+            sums->g[x] = pixelG[x] + pixelG[x + 1] + pixelG[x + 2];
+            sums->b[x] = pixelB[x] + pixelB[x + 1] + pixelB[x + 2];
+            sums->count[x] = pixelCount[x] + pixelCount[x + 1] + pixelCount[x + 2];
+        }
+    };
+
+    // Zero count means no opaque neighbours, the sums are zero too in this case.
+    static constexpr uint32_t reciprocals[9] = {0, 65536, 32768, 21846, 16384, 13108, 10923, 9363, 8192};
+
+    // Sliding window of three rows. Missing rows at the top & bottom edges are all zeros.
+    RowSums zero, prev, curr, next;
+    zero.r.assign(w, 0);
+    zero.g.assign(w, 0);
+    zero.b.assign(w, 0);
+    zero.count.assign(w, 0);
+    prev = zero;
+    computeRowSums(0, &curr);
+
+    std::vector<uint16_t> r(w), g(w), b(w), count(w);
+    for (size_t y = 0; y < h; y++) {
+        if (y + 1 < h) {
+            computeRowSums(y + 1, &next);
+        } else {
+            next = zero;
+        }
+
+        for (size_t x = 0; x < w; x++) {
+            r[x] = prev.r[x] + curr.r[x] + next.r[x];
+            g[x] = prev.g[x] + curr.g[x] + next.g[x];
+            b[x] = prev.b[x] + curr.b[x] + next.b[x];
+            count[x] = prev.count[x] + curr.count[x] + next.count[x];
+        }
+
+        // The center pixel doesn't contribute to the sums for transparent pixels, so we're getting exactly the sum
+        // over the neighbours. Division is done through a reciprocal table, which is exact for sums up to 8 * 255.
+        std::span<const uint8_t> src = indexedImage[y];
+        std::span<Color> dst = (*image)[y];
+        for (size_t x = 0; x < w; x++) {
+            if (src[x] != 0)
+                continue;
+
+            uint32_t reciprocal = reciprocals[count[x]];
+            dst[x] = Color((r[x] * reciprocal) >> 16, (g[x] * reciprocal) >> 16, (b[x] * reciprocal) >> 16, 0);
+        }
+
+        std::swap(prev, curr);
+        std::swap(curr, next);
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "Library/Color/Color.h"
+
+#include "Image.h"
+#include "Palette.h"
+
+/**
+ * Low-level pixel kernels used when converting LOD images into RGBA. These work on raw spans, and are written so
+ * that the compiler can keep the loops branch-free and vectorize them where possible.
+ */
+
+/**
+ * Expands an indexed image into RGBA.
+ *
+ * @param src                           Palette indices.
+ * @param palette                       Palette to use.
+ * @param[out] dst                      Output pixels, must be the same size as `src`.
+ */
+void expandPalette(std::span<const uint8_t> src, const Palette &palette, std::span<Color> dst);
+
+/**
+ * Replaces all pixels of the given color, e.g. for color key masking.
+ *
+ * @param pixels                        Pixels to process.
+ * @param from                          Color to replace.
+ * @param to                            Replacement color.
+ */
+void replaceColor(std::span<Color> pixels, Color from, Color to);
+
+/**
+ * Replaces the colors of all transparent pixels (those with palette index zero) with the average color of their
+ * non-transparent neighbours, keeping zero alpha. This gets rid of the dark halos around the opaque areas when the
+ * texture is sampled with linear filtering.
+ *
+ * Neighbour sums are calculated with a separable 3x3 box filter, so that each source pixel is only looked at a
+ * constant number of times.
+ *
+ * @param indexedImage                  Source indexed image.
+ * @param palette                       Palette to use for the non-transparent pixels.
+ * @param[in,out] image                 RGBA image of the same size as `indexedImage`. Only the transparent pixels
+ *                                      are overwritten.
+ */
+void bleedTransparentPixels(GrayscaleImageView indexedImage, const Palette &palette, RgbaImage *image);
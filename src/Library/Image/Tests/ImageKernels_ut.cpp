@@ -0,0 +1,102 @@
+#include <cstdint>
+#include <random>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Image/ImageKernels.h"
+
+static GrayscaleImage makeIndexedImage(int width, int height, std::mt19937 *rng) {
+    GrayscaleImage result = GrayscaleImage::uninitialized(width, height);
+    for (uint8_t &pixel : result.pixels())
+        pixel = (*rng)() % 4 == 0 ? 0 : (*rng)() % 256; // Lots of transparent pixels.
+    return result;
+}
+
+static Palette makePalette(std::mt19937 *rng) {
+    Palette result;
+    for (Color &color : result.colors)
+        color = Color::fromC32((*rng)());
+    return result;
+}
+
+// Straightforward per-pixel implementation, this is how it used to be done in ImageLoader.
+static Color referenceBleed(GrayscaleImageView image, const Palette &palette, int x, int y) {
+    int count = 0, r = 0, g = 0, b = 0;
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            int xx = x + dx;
+            int yy = y + dy;
+            if ((dx == 0 && dy == 0) || xx < 0 || yy < 0 || xx >= image.width() || yy >= image.height())
+                continue;
+
+            uint8_t index = image[yy][xx];
+            if (index != 0) {
+                count++;
+                r += palette.colors[index].r;
+                g += palette.colors[index].g;
+                b += palette.colors[index].b;
+            }
+        }
+    }
+
+    if (count != 0) {
+        r /= count;
+        g /= count;
+        b /= count;
+    }
+    return Color(r, g, b, 0);
+}
+
+UNIT_TEST(ImageKernels, ExpandPalette) {
+    std::mt19937 rng(1);
+    Palette palette = makePalette(&rng);
+    for (int width : {1, 3, 4, 5, 17, 64}) {
+        GrayscaleImage indexed = makeIndexedImage(width, 3, &rng);
+        RgbaImage rgba = RgbaImage::uninitialized(width, 3);
+        expandPalette(indexed.pixels(), palette, rgba.pixels());
+
+        for (size_t i = 0; i < indexed.pixels().size(); i++)
+            EXPECT_EQ(rgba.pixels()[i], palette.colors[indexed.pixels()[i]]);
+    }
+}
+
+UNIT_TEST(ImageKernels, ReplaceColor) {
+    Color key(0, 255, 255);
+    RgbaImage image = RgbaImage::solid(key, 7, 3);
+    image[1][3] = Color(1, 2, 3);
+    image[2][6] = Color(0, 255, 255, 0); // Only alpha differs, shouldn't be replaced.
+
+    replaceColor(image.pixels(), key, Color());
+
+    for (int y = 0; y < 3; y++) {
+        for (int x = 0; x < 7; x++) {
+            if (y == 1 && x == 3) {
+                EXPECT_EQ(image[y][x], Color(1, 2, 3));
+            } else if (y == 2 && x == 6) {
+                EXPECT_EQ(image[y][x], Color(0, 255, 255, 0));
+            } else {
+                EXPECT_EQ(image[y][x], Color());
+            }
+        }
+    }
+}
+
+UNIT_TEST(ImageKernels, BleedTransparentPixels) {
+    std::mt19937 rng(2);
+    Palette palette = makePalette(&rng);
+
+    for (auto [width, height] : {std::pair(1, 1), std::pair(1, 9), std::pair(9, 1), std::pair(2, 2), std::pair(31, 17)}) {
+        GrayscaleImage indexed = makeIndexedImage(width, height, &rng);
+        RgbaImage rgba = RgbaImage::uninitialized(width, height);
+        expandPalette(indexed.pixels(), palette, rgba.pixels());
+        bleedTransparentPixels(indexed, palette, &rgba);
+
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                uint8_t index = indexed[y][x];
+                Color expected = index == 0 ? referenceBleed(indexed, palette, x, y) : palette.colors[index];
+                EXPECT_EQ(rgba[y][x], expected);
+            }
+        }
+    }
+}
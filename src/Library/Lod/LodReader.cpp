@@ -3,7 +3,8 @@
 #include <cassert>
 #include <utility>
 #include <algorithm>
-#include <unordered_map>
+#include <bit>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -67,6 +68,18 @@ static std::vector<LodEntry> parseFileEntries(InputStream &stream, const LodEntr
     return result;
 }
 
+/**
+ * FNV-1a over case-folded characters. Folding on the fly means that lookups don't need to allocate a lowercase copy
+ * of the name.
+ */
+static uint32_t hashName(std::string_view name) {
+    uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(ascii::toLower(c));
+        hash *= 16777619u;
+    }
+    return hash;
+}
 
 LodReader::LodReader() = default;
 
@@ -102,21 +115,50 @@ void LodReader::open(Blob blob, LodOpenFlags openFlags) {
     rootEntry.dataSize = blob.size() - rootEntry.dataOffset;
 
     BlobInputStream dirStream(blob.subBlob(rootEntry.dataOffset, rootEntry.dataSize));
-    std::unordered_map<std::string, LodRegion> files;
-    for (const LodEntry &entry : parseFileEntries(dirStream, rootEntry, version)) {
-        std::string name = ascii::toLower(entry.name);
-        if (files.contains(name)) {
-            if (openFlags & LOD_ALLOW_DUPLICATES) {
-                continue; // Only the first entry is kept in this case.
-            } else {
-                throw Exception("File '{}' is not a valid LOD: contains duplicate entries for '{}'", blob.displayPath(), name);
-            }
+    std::vector<LodEntry> fileEntries = parseFileEntries(dirStream, rootEntry, version);
+
+    // Pack all lowercase names into a single buffer.
+    size_t namesSize = 0;
+    for (const LodEntry &entry : fileEntries)
+        namesSize += entry.name.size();
+    std::unique_ptr<char[]> names = std::make_unique<char[]>(namesSize);
+
+    std::vector<LodIndexEntry> entries;
+    entries.reserve(fileEntries.size());
+    char *namePos = names.get();
+    for (const LodEntry &entry : fileEntries) {
+        std::transform(entry.name.begin(), entry.name.end(), namePos, [](char c) { return ascii::toLower(c); });
+
+        LodIndexEntry &indexEntry = entries.emplace_back();
+        indexEntry.name = std::string_view(namePos, entry.name.size());
+        indexEntry.offset = rootEntry.dataOffset + entry.dataOffset;
+        indexEntry.size = entry.dataSize;
+        namePos += entry.name.size();
+    }
+
+    // Stable sort keeps the duplicates in file order.
+    auto nameLess = [](const LodIndexEntry &l, const LodIndexEntry &r) { return l.name < r.name; };
+    auto nameEquals = [](const LodIndexEntry &l, const LodIndexEntry &r) { return l.name == r.name; };
+    std::stable_sort(entries.begin(), entries.end(), nameLess);
+    auto duplicate = std::adjacent_find(entries.begin(), entries.end(), nameEquals);
+    if (duplicate != entries.end()) {
+        if (openFlags & LOD_ALLOW_DUPLICATES) {
+            entries.erase(std::unique(entries.begin(), entries.end(), nameEquals), entries.end()); // Only the first entry is kept in this case.
+        } else {
+            throw Exception("File '{}' is not a valid LOD: contains duplicate entries for '{}'", blob.displayPath(), duplicate->name);
         }
+    }
 
-        LodRegion region;
-        region.offset = rootEntry.dataOffset + entry.dataOffset;
-        region.size = entry.dataSize;
-        files.emplace(std::move(name), region);
+    // Hash table is kept at most half full, so that the probe sequences stay short.
+    std::vector<LodBucket> buckets(std::bit_ceil(std::max<size_t>(entries.size() * 2, 1)));
+    size_t mask = buckets.size() - 1;
+    for (size_t i = 0; i < entries.size(); i++) {
+        uint32_t hash = hashName(entries[i].name);
+        size_t pos = hash & mask;
+        while (buckets[pos].index != EMPTY_BUCKET)
+            pos = (pos + 1) & mask;
+        buckets[pos].hash = hash;
+        buckets[pos].index = i;
     }
 
     // All good, this is a valid LOD, can update `this`.
@@ -124,30 +166,41 @@ void LodReader::open(Blob blob, LodOpenFlags openFlags) {
     _info.version = version;
     _info.description = std::move(header.description);
     _info.rootName = std::move(rootEntry.name);
-    _files = std::move(files);
+    _names = std::move(names);
+    _entries = std::move(entries);
+    _buckets = std::move(buckets);
 }
 
 void LodReader::close() {
     // Double-closing is OK.
     _lod = Blob();
     _info = {};
-    _files = {};
+    _entries = {};
+    _buckets = {};
+    _names.reset();
 }
 
 bool LodReader::exists(std::string_view filename) const {
     assert(isOpen());
 
-    return _files.contains(ascii::toLower(filename));
+    return find(filename) != nullptr;
 }
 
 Blob LodReader::read(std::string_view filename) const {
     assert(isOpen());
 
-    const auto pos = _files.find(ascii::toLower(filename));
-    if (pos == _files.cend())
+    const LodIndexEntry *entry = find(filename);
+    if (!entry)
         throw Exception("Entry '{}' doesn't exist in LOD file '{}'", filename, _lod.displayPath());
 
-    return _lod.subBlob(pos->second.offset, pos->second.size).withDisplayPath(displayPath(filename));
+    return _lod.subBlob(entry->offset, entry->size).withDisplayPath(displayPath(filename));
+}
+
+Blob LodReader::read(const LodIndexEntry &entry) const {
+    assert(isOpen());
+    assert(&entry >= _entries.data() && &entry < _entries.data() + _entries.size());
+
+    return _lod.subBlob(entry.offset, entry.size).withDisplayPath(displayPath(entry.name));
 }
 
 std::string LodReader::displayPath(std::string_view filename) const {
@@ -158,18 +211,35 @@ std::vector<std::string> LodReader::ls() const {
     assert(isOpen());
 
     std::vector<std::string> result;
-    for (const auto &[name, _] : _files)
-        result.push_back(name);
-    std::sort(result.begin(), result.end());
+    result.reserve(_entries.size());
+    for (const LodIndexEntry &entry : _entries)
+        result.emplace_back(entry.name);
     return result;
 }
 
+std::span<const LodIndexEntry> LodReader::entries() const {
+    assert(isOpen());
+
+    return _entries;
+}
+
 [[nodiscard]] const LodInfo &LodReader::info() const {
     assert(isOpen());
 
     return _info;
 }
 
+const LodIndexEntry *LodReader::find(std::string_view filename) const {
+    uint32_t hash = hashName(filename);
+    size_t mask = _buckets.size() - 1;
+    for (size_t pos = hash & mask; _buckets[pos].index != EMPTY_BUCKET; pos = (pos + 1) & mask) {
+        const LodBucket &bucket = _buckets[pos];
+        if (bucket.hash == hash && ascii::noCaseEquals(_entries[bucket.index].name, filename))
+            return &_entries[bucket.index];
+    }
+    return nullptr;
+}
+
 bool lod::detect(const Blob &data) {
     if (data.size() < sizeof(LodHeader_MM6) + sizeof(LodEntry_MM6)) // Header + directory entry.
         return false;
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <unordered_map>
 
 #include "Utility/Memory/Blob.h"
 
@@ -11,12 +14,24 @@
 
 class InputStream;
 
+/**
+ * Single file entry in the LOD index.
+ */
+struct LodIndexEntry {
+    std::string_view name; // Lowercase file name. Points into `LodReader`'s name storage, valid until the LOD is closed.
+    size_t offset = 0; // Offset of the file data from the start of the LOD.
+    size_t size = 0; // Size of the file data.
+};
+
 /**
  * A single stop shop to read LOD files.
  * Even though LODs support a multi-directory structure, in reality vanilla games only ever had a single directory each.
  * 
  * Given that we don't plan to expand the LOD format support, when resolving the files this class always looks
  * into the first available directory, which is consistent with the vanilla behaviour.
+ *
+ * File index is built once in `open` and is immutable afterwards, so all `const` methods can be safely called from
+ * several threads at once.
  */
 class LodReader final {
  public:
@@ -62,6 +77,13 @@ class LodReader final {
      */
     [[nodiscard]] Blob read(std::string_view filename) const;
 
+    /**
+     * @param entry                     LOD file entry, as returned from `entries`.
+     * @return                          Contents of the file inside the LOD as a `Blob`. Unlike the overload above,
+     *                                  this one doesn't need to look anything up.
+     */
+    [[nodiscard]] Blob read(const LodIndexEntry &entry) const;
+
     /**
      * @param filename                  Name of the LOD file entry.
      * @return                          Display path for the given LOD entry. Same as `read(filename).displayPath()` but
@@ -70,10 +92,17 @@ class LodReader final {
     [[nodiscard]] std::string displayPath(std::string_view filename) const;
 
     /**
-     * @return                          List of all files in a LOD.
+     * @return                          List of all files in a LOD, sorted by name. Use `entries` if you don't need
+     *                                  a copy.
      */
     [[nodiscard]] std::vector<std::string> ls() const;
 
+    /**
+     * @return                          All files in a LOD, sorted by name. Iterating over the returned span doesn't
+     *                                  allocate, and the entries stay valid until the LOD is closed.
+     */
+    [[nodiscard]] std::span<const LodIndexEntry> entries() const;
+
     /**
      * @return                          LOD info, containing LOD version, description of this LOD file as specified in
      *                                  the LOD header, and a name of the single folder inside this LOD file.
@@ -81,15 +110,21 @@ class LodReader final {
     [[nodiscard]] const LodInfo &info() const;
 
  private:
-    struct LodRegion {
-        size_t offset = 0;
-        size_t size = 0;
+    static constexpr uint32_t EMPTY_BUCKET = UINT32_MAX;
+
+    struct LodBucket {
+        uint32_t hash = 0;
+        uint32_t index = EMPTY_BUCKET; // Index into `_entries`.
     };
 
+    [[nodiscard]] const LodIndexEntry *find(std::string_view filename) const;
+
  private:
     Blob _lod;
     LodInfo _info;
-    std::unordered_map<std::string, LodRegion> _files;
+    std::unique_ptr<char[]> _names; // Storage for all the file names, entry names point in here.
+    std::vector<LodIndexEntry> _entries; // Sorted by name.
+    std::vector<LodBucket> _buckets; // Open addressing hash table over `_entries`, keyed by case-folded name.
 };
 
 namespace lod {
@@ -1,9 +1,16 @@
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Testing/Unit/UnitTest.h"
 
 #include "Library/Lod/LodReader.h"
+#include "Library/Lod/LodWriter.h"
+
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/String/Ascii.h"
+#include "Utility/String/Format.h"
 
 const char brokenLod[] =
     "LOD\0"         "Game"          "MMVI"          "\0\0\0\0"      // signature, version
@@ -66,3 +73,30 @@ UNIT_TEST(LodReader, DisplayPath) {
 UNIT_TEST(LodReader, Detect) {
     EXPECT_TRUE(lod::detect(Blob::view(brokenLod, sizeof(brokenLod))));
 }
+
+UNIT_TEST(LodReader, Index) {
+    LodInfo info;
+    info.version = LOD_VERSION_MM7;
+    info.rootName = "data";
+
+    Blob lod;
+    BlobOutputStream stream(&lod, "index.lod");
+    LodWriter writer(&stream, info);
+    for (int i = 0; i < 100; i++)
+        writer.write(fmt::format("File{:03}.Bin", i), Blob::fromString(std::to_string(i)));
+    writer.close();
+    stream.close();
+
+    LodReader reader(std::move(lod));
+    std::span<const LodIndexEntry> entries = reader.entries();
+    ASSERT_EQ(entries.size(), 100);
+    for (int i = 0; i < 100; i++) {
+        std::string name = fmt::format("File{:03}.Bin", i);
+        EXPECT_EQ(entries[i].name, ascii::toLower(name)); // Entries are lowercase & sorted.
+        EXPECT_EQ(reader.read(entries[i]).string_view(), std::to_string(i));
+        EXPECT_EQ(reader.read(name).string_view(), std::to_string(i));
+        EXPECT_TRUE(reader.exists(ascii::toUpper(name)));
+    }
+    EXPECT_FALSE(reader.exists("file100.bin"));
+    EXPECT_FALSE(reader.exists(""));
+}
@@ -1,5 +1,7 @@
 #include "LodFormats.h"
 
+#include <cassert>
+#include <cstring>
 #include <optional>
 #include <span>
 #include <vector>
@@ -15,6 +17,7 @@
 #include "Library/Serialization/EnumSerialization.h"
 #include "Library/Snapshots/SnapshotSerialization.h"
 
+#include "Utility/Memory/Arena.h"
 #include "Utility/Streams/MemoryInputStream.h"
 #include "Utility/Streams/BlobInputStream.h"
 #include "Utility/Memory/Blob.h"
@@ -167,8 +170,8 @@ Blob lod::decodeMaybeCompressed(const Blob &blob) {
     return Blob::share(blob); // Not compressed.
 }
 
-Blob lod::encodeCompressed(const Blob &blob) {
-    Blob compressed = zlib::compress(blob);
+Blob lod::encodeCompressed(const Blob &blob, ThreadPool *pool) {
+    Blob compressed = pool ? zlib::compress(blob, pool) : zlib::compress(blob);
 
     LodCompressionHeader_MM6 header;
     header.version = 91969;
@@ -238,8 +241,17 @@ Sizei lod::decodeImageSize(const Blob &blob) {
     return Sizei(header.width, header.height);
 }
 
-LodSprite lod::decodeSprite(const Blob &blob) {
-    if (!detectSprite(blob))
+/**
+ * Decodes a LOD sprite.
+ *
+ * @param blob                          Sprite blob.
+ * @param allocate                      Allocation function, takes width & height, returns pointer to uninitialized
+ *                                      pixel memory.
+ * @param paletteId[out]                Palette id of the sprite.
+ * @return                              Pointer returned by `allocate`, or `nullptr` for empty sprites.
+ */
+static uint8_t *decodeSpriteInto(const Blob &blob, const auto &allocate, int *paletteId) {
+    if (!lod::detectSprite(blob))
         throw Exception("Cannot decode LOD entry '{}' as LOD sprite", blob.displayPath());
 
     BlobInputStream stream(blob);
@@ -253,27 +265,55 @@ LodSprite lod::decodeSprite(const Blob &blob) {
     if (header.decompressedSize)
         pixels = zlib::uncompress(pixels, header.decompressedSize);
 
-    LodSprite result;
-    result.paletteId = header.paletteId;
-    result.image = GrayscaleImage::solid(0, header.width, header.height);
+    *paletteId = header.paletteId;
+    if (header.width == 0 || header.height == 0)
+        return nullptr;
 
+    uint8_t *result = allocate(header.width, header.height);
     for (size_t y = 0; y < header.height; y++) {
         const LodSpriteLine_MM6 &line = lines[y];
+        uint8_t *dst = result + y * header.width;
 
-        if (line.begin == line.end)
-            continue; // Empty line.
+        if (line.begin == line.end) {
+            memset(dst, 0, header.width); // Empty line.
+            continue;
+        }
 
         if (line.begin < 0 || line.end < 0 || line.begin > header.width || line.end > header.width || line.begin > line.end ||
             line.offset > pixels.size() || line.offset + line.end - line.begin > pixels.size())
             throw Exception("Cannot decode sprite LOD entry '{}': invalid sprite line encountered at y={}",
                             blob.displayPath(), y);
 
-        memcpy(result.image[y].data() + line.begin, static_cast<const char *>(pixels.data()) + line.offset, line.end - line.begin);
+        memset(dst, 0, line.begin);
+        memcpy(dst + line.begin, static_cast<const char *>(pixels.data()) + line.offset, line.end - line.begin);
+        memset(dst + line.end, 0, header.width - line.end);
     }
 
     return result;
 }
 
+LodSprite lod::decodeSprite(const Blob &blob) {
+    LodSprite result;
+    decodeSpriteInto(blob, [&](int width, int height) {
+        result.image = GrayscaleImage::uninitialized(width, height);
+        return result.image.pixels().data();
+    }, &result.paletteId);
+    return result;
+}
+
+LodSpriteView lod::decodeSprite(const Blob &blob, Arena *arena) {
+    assert(arena);
+
+    // Note that if decoding throws, the memory allocated from the arena is not reclaimed until the arena is rewound.
+    Sizei size;
+    int paletteId = 0;
+    const uint8_t *pixels = decodeSpriteInto(blob, [&](int width, int height) {
+        size = Sizei(width, height);
+        return static_cast<uint8_t *>(arena->allocate(width * height, 1));
+    }, &paletteId);
+    return LodSpriteView(GrayscaleImageView(pixels, size), paletteId);
+}
+
 LodFont lod::decodeFont(const Blob &blob) {
     if (!detectFont(blob))
         throw Exception("Cannot decode LOD entry '{}' as LOD font", blob.displayPath());
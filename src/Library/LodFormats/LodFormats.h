@@ -8,7 +8,9 @@
 #include "LodSprite.h"
 #include "LodFont.h"
 
+class Arena;
 class Blob;
+class ThreadPool;
 
 namespace lod {
 
@@ -51,9 +53,12 @@ Blob decodeMaybeCompressed(const Blob &blob);
  * This function compresses the provided `Blob` into the compressed lod data format.
  *
  * @param blob                          `Blob` to compress.
+ * @param pool                          Thread pool to use for compression. If provided, the data is compressed in
+ *                                      parallel, in chunks. Resulting compressed data will be slightly different, but
+ *                                      can be decompressed in exactly the same way.
  * @return                              Compressed `Blob`.
  */
-Blob encodeCompressed(const Blob &blob);
+Blob encodeCompressed(const Blob &blob, ThreadPool *pool = nullptr);
 
 /**
  * This function processes lod images and lod palettes. In case of the former, the pixel data is ignored.
@@ -92,6 +97,18 @@ Sizei decodeImageSize(const Blob &blob);
  */
 LodSprite decodeSprite(const Blob &blob);
 
+/**
+ * Same as `decodeSprite(const Blob &)`, but decodes the sprite into memory allocated from the provided arena. RLE
+ * rows are read straight from the provided blob (unless the sprite is compressed), and each row is written exactly
+ * once.
+ *
+ * @param blob                          Sprite `blob`, as read from a LOD file.
+ * @param arena                         Arena to allocate the pixel data from.
+ * @return                              Decoded sprite, pointing into the memory allocated from `arena`.
+ * @throw Exception                     If the format is not recognized.
+ */
+LodSpriteView decodeSprite(const Blob &blob, Arena *arena);
+
 /**
  * This function processes lod fonts.
  *
@@ -8,3 +8,22 @@ struct LodSprite {
                        // from `SpriteFrameTable`. Default palette for monster sprites usually has cyan / magenta for
                        // parts that are recolored, and this is obviously not the palette that's used in the game.
 };
+
+/**
+ * Same as `LodSprite`, but doesn't own the pixel data, which usually lives in an `Arena`.
+ *
+ * @see lod::decodeSprite(const Blob &, Arena *)
+ */
+struct LodSpriteView {
+    GrayscaleImageView image;
+    int paletteId = 0;
+
+    LodSpriteView() = default;
+    LodSpriteView(GrayscaleImageView image, int paletteId) : image(image), paletteId(paletteId) {}
+    explicit LodSpriteView(const LodSprite &sprite) : image(sprite.image), paletteId(sprite.paletteId) {}
+    explicit LodSpriteView(LodSprite &&) = delete; // Would dangle.
+
+    explicit operator bool() const {
+        return static_cast<bool>(image);
+    }
+};
@@ -1,6 +1,8 @@
 #include "AudioPlayer.h"
 
 #include <algorithm>
+#include <cassert>
+#include <chrono>
 #include <map>
 #include <string>
 #include <utility>
@@ -20,10 +22,12 @@
 
 #include "GUI/GUIWindow.h"
 
-#include "Media/AudioBufferDataSource.h"
+#include "Media/AudioPcmDataSource.h"
 
 #include "Library/Logger/Logger.h"
 
+#include "Utility/Concurrency/ThreadPool.h"
+
 #include "SoundList.h"
 #include "OpenALTrack16.h"
 #include "OpenALSample16.h"
@@ -42,7 +46,11 @@ constexpr Pid FAKE_HOUSE_SPEECH_PID = Pid::fromPacked(-6);
 
 extern OpenALSoundProvider *provider;
 
-AudioPlayer::~AudioPlayer() = default;
+AudioPlayer::~AudioPlayer() {
+    // Decoding tasks reference _sndReader.
+    for (auto &[_, future] : _pendingSounds)
+        future.wait();
+}
 
 void AudioPlayer::MusicPlayTrack(MusicId eTrack) {
     if (currentMusicTrack == eTrack) {
@@ -130,9 +138,7 @@ void AudioPlayer::SetMasterVolume(int level) {
 
     _regularSoundPool.setVolume(uMasterVolume);
     _loopingSoundPool.setVolume(uMasterVolume);
-    if (_currentWalkingSample) {
-        _currentWalkingSample->SetVolume(uMasterVolume);
-    }
+    _walkingSoundPool.setVolume(uMasterVolume);
 }
 
 void AudioPlayer::SetVoiceVolume(int level) {
@@ -150,10 +156,8 @@ void AudioPlayer::stopSounds() {
     _voiceSoundPool.stop();
     _regularSoundPool.stop();
     _loopingSoundPool.stop();
-    if (_currentWalkingSample) {
-        _currentWalkingSample->Stop();
-        _currentWalkingSample = nullptr;
-    }
+    _walkingSoundPool.stop();
+    _queuedSounds.clear();
 }
 
 void AudioPlayer::stopVoiceSounds() {
@@ -162,6 +166,10 @@ void AudioPlayer::stopVoiceSounds() {
     }
 
     _voiceSoundPool.stop();
+    dropQueuedSounds([](const QueuedSound &queued) {
+        return queued.mode == SOUND_MODE_SPEECH ||
+               (queued.mode == SOUND_MODE_PID && queued.pid.type() == OBJECT_Character);
+    });
 }
 
 void AudioPlayer::stopWalkingSounds() {
@@ -169,19 +177,15 @@ void AudioPlayer::stopWalkingSounds() {
         return;
     }
 
-    if (_currentWalkingSample) {
-        _currentWalkingSample->Stop();
-        _currentWalkingSample = nullptr;
-    }
+    _walkingSoundPool.stop();
+    dropQueuedSounds([](const QueuedSound &queued) { return queued.mode == SOUND_MODE_WALKING; });
 }
 
 void AudioPlayer::resumeSounds() {
     _voiceSoundPool.resume();
     _regularSoundPool.resume();
     _loopingSoundPool.resume();
-    if (_currentWalkingSample) {
-        _currentWalkingSample->Resume();
-    }
+    _walkingSoundPool.resume();
 }
 
 void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
@@ -203,39 +207,155 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
 
     //logger->Info("AudioPlayer: sound id {} found as '{}'", eSoundID, si.sName);
 
-    if (!loadSoundDataSource(si)) return;
+    SoundPlaybackResult result = SOUND_PLAYBACK_INVALID;
+    PAudioDataSource source = _soundCache.find(eSoundID);
+    if (source) {
+        _soundCache.recordHit();
+        result = startSound(si, source, mode, pid);
+    } else if (_pendingSounds.contains(eSoundID) || startDecoding(si, engine->threadPool())) {
+        _soundCache.recordMiss();
+
+        // Not decoded yet, queue the request. Unique sounds follow the same rules as in `startSound`, and are skipped
+        // if the same sound is already playing or queued. Other repeated requests for the same sound are merged. For
+        // the call observer a queued sound counts as played, so that the recorded sound tapes don't depend on
+        // decoding speed.
+        SoundSlot slot = soundSlot(eSoundID, mode, pid);
+        auto sameSlot = [&](const QueuedSound &queued) {
+            SoundSlot other = soundSlot(queued.id, queued.mode, queued.pid);
+            return other.pool == slot.pool && other.id == slot.id && other.pid == slot.pid;
+        };
+        auto sameRequest = [&](const QueuedSound &queued) {
+            return queued.id == eSoundID && queued.mode == mode && queued.pid == pid;
+        };
+        if (slot.pool && !slot.restarts && (isSlotPlaying(slot) || std::ranges::any_of(_queuedSounds, sameSlot))) {
+            result = SOUND_PLAYBACK_SKIPPED;
+        } else {
+            if (mode == SOUND_MODE_UI || std::ranges::none_of(_queuedSounds, sameRequest))
+                _queuedSounds.push_back({eSoundID, mode, pid});
+            result = SOUND_PLAYBACK_SUCCEEDED;
+            logger->trace("AudioPlayer: sound {} is not decoded yet, queued", std::to_underlying(eSoundID));
+        }
+    } else {
+        return;
+    }
+
+    if (result == SOUND_PLAYBACK_FAILED || result == SOUND_PLAYBACK_SUCCEEDED || result == SOUND_PLAYBACK_DROPPED) {
+        // Only log sounds that actually play or tried to play. Dropped sounds are logged too, so that the recorded
+        // sound tapes don't depend on the voice limits.
+        if (engine->callObserver)
+            engine->callObserver->notify(CALL_PLAY_SOUND, eSoundID);
+    }
 
-    PAudioSample sample = CreateAudioSample();
+    if (source || result == SOUND_PLAYBACK_SKIPPED)
+        logPlaybackResult(si, result);
+}
+
+/**
+ * @param pid                           Sound emitting object.
+ * @return                              Current position of the object, or `std::nullopt` if the object is gone or
+ *                                      doesn't have a position in the world.
+ */
+static std::optional<Vec3f> soundSourcePosition(Pid pid) {
+    size_t id = pid.id();
+    switch (pid.type()) {
+        case OBJECT_Door: {
+            if (uCurrentlyLoadedLevelType != LEVEL_INDOOR || id >= pIndoor->pDoors.size())
+                return std::nullopt;
+            const BLVDoor &door = pIndoor->pDoors[id];
+            return Vec3f(door.pXOffsets[0], door.pYOffsets[0], door.pZOffsets[0]);
+        }
+        case OBJECT_Actor:
+            if (id >= pActors.size())
+                return std::nullopt;
+            return pActors[id].pos;
+        case OBJECT_Decoration:
+            if (id >= pLevelDecorations.size())
+                return std::nullopt;
+            return pLevelDecorations[id].vPosition;
+        case OBJECT_Sprite:
+            if (id >= pSpriteObjects.size())
+                return std::nullopt;
+            return pSpriteObjects[id].vPosition;
+        default:
+            return std::nullopt;
+    }
+}
+
+AudioPlayer::SoundSlot AudioPlayer::soundSlot(SoundId id, SoundPlaybackMode mode, Pid pid) {
+    // This should be kept in sync with `startSound`.
+    switch (mode) {
+        case SOUND_MODE_EXCLUSIVE:
+        case SOUND_MODE_MUSIC:
+        case SOUND_MODE_SPEECH:
+            return {&_regularSoundPool, id, Pid(), true};
+        case SOUND_MODE_NON_RESETTABLE:
+            return {&_regularSoundPool, id, Pid(), false};
+        case SOUND_MODE_HOUSE_DOOR:
+            return {&_regularSoundPool, SOUND_Invalid, FAKE_HOUSE_DOOR_PID, true};
+        case SOUND_MODE_HOUSE_SPEECH:
+            return {&_regularSoundPool, SOUND_Invalid, FAKE_HOUSE_SPEECH_PID, true};
+        case SOUND_MODE_PID:
+            break;
+        default:
+            return {};
+    }
+
+    switch (pid.type()) {
+        case OBJECT_Door:
+        case OBJECT_Sprite:
+        case OBJECT_Face:
+            return {&_regularSoundPool, SOUND_Invalid, pid, false};
+        case OBJECT_Character:
+            return {&_voiceSoundPool, SOUND_Invalid, pid, false};
+        case OBJECT_Actor:
+            return {&_regularSoundPool, id, Pid(), false};
+        default:
+            return {};
+    }
+}
+
+bool AudioPlayer::isSlotPlaying(const SoundSlot &slot) {
+    assert(slot.pool);
+    return slot.id != SOUND_Invalid ? slot.pool->hasSoundId(slot.id) : slot.pool->hasPid(slot.pid);
+}
+
+SoundPlaybackResult AudioPlayer::startSound(SoundInfo *si, const PAudioDataSource &source, SoundPlaybackMode mode,
+                                            Pid pid) {
+    assert(source);
 
     SoundPlaybackResult result = SOUND_PLAYBACK_INVALID;
-    sample->SetVolume(uMasterVolume);
+    SoundPlaybackParams params;
+    params.volume = uMasterVolume;
+
+    auto setPosition = [&](Vec3f position) {
+        params.positional = true;
+        params.position = position;
+        params.priority = SOUND_PRIORITY_WORLD;
+        params.owner = pid;
+    };
 
     if (mode == SOUND_MODE_UI) {
-        result = _regularSoundPool.playNew(sample, si->dataSource);
+        result = _regularSoundPool.playNew(source, params);
     } else if (mode == SOUND_MODE_EXCLUSIVE) {
-        _regularSoundPool.stopSoundId(eSoundID);
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        _regularSoundPool.stopSoundId(si->uSoundID);
+        result = _regularSoundPool.playUniqueSoundId(source, si->uSoundID, params);
     } else if (mode == SOUND_MODE_NON_RESETTABLE) {
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        result = _regularSoundPool.playUniqueSoundId(source, si->uSoundID, params);
     } else if (mode == SOUND_MODE_WALKING) {
-        if (_currentWalkingSample) {
-            _currentWalkingSample->Stop();
-        }
-        _currentWalkingSample = sample;
-        _currentWalkingSample->Open(si->dataSource);
-        _currentWalkingSample->Play();
+        _walkingSoundPool.stop();
+        _walkingSoundPool.playNew(source, params);
     } else if (mode == SOUND_MODE_MUSIC) {
-        sample->SetVolume(uMusicVolume);
-        _regularSoundPool.stopSoundId(eSoundID);
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        params.volume = uMusicVolume;
+        _regularSoundPool.stopSoundId(si->uSoundID);
+        result = _regularSoundPool.playUniqueSoundId(source, si->uSoundID, params);
     } else if (mode == SOUND_MODE_SPEECH) {
-        sample->SetVolume(uVoiceVolume);
-        _regularSoundPool.stopSoundId(eSoundID);
-        result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID);
+        params.volume = uVoiceVolume;
+        _regularSoundPool.stopSoundId(si->uSoundID);
+        result = _regularSoundPool.playUniqueSoundId(source, si->uSoundID, params);
     } else if (mode == SOUND_MODE_HOUSE_DOOR || mode == SOUND_MODE_HOUSE_SPEECH) {
         pid = mode == SOUND_MODE_HOUSE_DOOR ? FAKE_HOUSE_DOOR_PID : FAKE_HOUSE_SPEECH_PID;
         _regularSoundPool.stopPid(pid);
-        _regularSoundPool.playUniquePid(sample, si->dataSource, pid);
+        _regularSoundPool.playUniquePid(source, pid, params);
     } else {
         assert(pid);
 
@@ -246,18 +366,18 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
                 assert(uCurrentlyLoadedLevelType == LEVEL_INDOOR);
                 assert((int)object_id < pIndoor->pDoors.size());
 
-                sample->SetPosition(pIndoor->pDoors[object_id].pXOffsets[0],
-                                    pIndoor->pDoors[object_id].pYOffsets[0],
-                                    pIndoor->pDoors[object_id].pZOffsets[0], MAX_SOUND_DIST);
+                setPosition(Vec3f(pIndoor->pDoors[object_id].pXOffsets[0],
+                                  pIndoor->pDoors[object_id].pYOffsets[0],
+                                  pIndoor->pDoors[object_id].pZOffsets[0]));
 
-                result = _regularSoundPool.playUniquePid(sample, si->dataSource, pid, true);
+                result = _regularSoundPool.playUniquePid(source, pid, params);
 
                 break;
             }
 
             case OBJECT_Character: {
-                sample->SetVolume(uVoiceVolume);
-                result = _voiceSoundPool.playUniquePid(sample, si->dataSource, pid);
+                params.volume = uVoiceVolume;
+                result = _voiceSoundPool.playUniquePid(source, pid, params);
 
                 break;
             }
@@ -265,13 +385,11 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
             case OBJECT_Actor: {
                 assert(object_id < pActors.size());
 
-                sample->SetPosition(pActors[object_id].pos.x,
-                                    pActors[object_id].pos.y,
-                                    pActors[object_id].pos.z, MAX_SOUND_DIST);
+                setPosition(pActors[object_id].pos);
 
                 // TODO(pskelton): Vanilla sounds like it does unique id but as exclusives
                 // Actors play unique sounds between them. Avoids issues where in a real time mob you are hit with a cacophony of overlapping attack noises.
-                result = _regularSoundPool.playUniqueSoundId(sample, si->dataSource, eSoundID, true);
+                result = _regularSoundPool.playUniqueSoundId(source, si->uSoundID, params);
 
                 break;
             }
@@ -279,11 +397,10 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
             case OBJECT_Decoration: {
                 assert(object_id < pLevelDecorations.size());
 
-                sample->SetPosition(pLevelDecorations[object_id].vPosition.x,
-                                    pLevelDecorations[object_id].vPosition.y,
-                                    pLevelDecorations[object_id].vPosition.z, MAX_SOUND_DIST);
+                setPosition(pLevelDecorations[object_id].vPosition);
+                params.priority = SOUND_PRIORITY_AMBIENT;
 
-                result = _loopingSoundPool.playNew(sample, si->dataSource, true);
+                result = _loopingSoundPool.playNew(source, params);
 
                 break;
             }
@@ -291,54 +408,56 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
             case OBJECT_Sprite: {
                 assert(object_id < pSpriteObjects.size());
 
-                sample->SetPosition(pSpriteObjects[object_id].vPosition.x,
-                                    pSpriteObjects[object_id].vPosition.y,
-                                    pSpriteObjects[object_id].vPosition.z, MAX_SOUND_DIST);
+                setPosition(pSpriteObjects[object_id].vPosition);
 
-                result = _regularSoundPool.playUniquePid(sample, si->dataSource, pid, true);
+                result = _regularSoundPool.playUniquePid(source, pid, params);
                 break;
             }
 
             case OBJECT_Face: {
-                result = _regularSoundPool.playUniquePid(sample, si->dataSource, pid);
+                result = _regularSoundPool.playUniquePid(source, pid, params);
 
                 break;
             }
 
             default: {
-                result = _regularSoundPool.playNew(sample, si->dataSource);
+                result = _regularSoundPool.playNew(source, params);
                 logger->warning("Unexpected object type from Pid in playSound");
                 break;
             }
         }
     }
 
-    if (result == SOUND_PLAYBACK_FAILED || result == SOUND_PLAYBACK_SUCCEEDED) {
-        // Only log sounds that actually play or tried to play
-        if (engine->callObserver)
-            engine->callObserver->notify(CALL_PLAY_SOUND, eSoundID);
-    }
+    return result;
+}
 
+void AudioPlayer::logPlaybackResult(SoundInfo *si, SoundPlaybackResult result) {
     switch (result) {
         case SOUND_PLAYBACK_FAILED:
             if (si->sName.empty()) {
-                logger->warning("AudioPlayer: failed to play audio {} with name '{}'", std::to_underlying(eSoundID), si->sName);
+                logger->warning("AudioPlayer: failed to play audio {} with name '{}'",
+                                std::to_underlying(si->uSoundID), si->sName);
             } else {
-                logger->warning("AudioPlayer: failed to play audio {}", std::to_underlying(eSoundID));
+                logger->warning("AudioPlayer: failed to play audio {}", std::to_underlying(si->uSoundID));
             }
             break;
         case SOUND_PLAYBACK_SKIPPED:
             if (si->sName.empty()) {
-                logger->trace("AudioPlayer: skipped playing sound {}", std::to_underlying(eSoundID));
+                logger->trace("AudioPlayer: skipped playing sound {}", std::to_underlying(si->uSoundID));
             } else {
-                logger->trace("AudioPlayer: skipped playing sound {} with name '{}'", std::to_underlying(eSoundID), si->sName);
+                logger->trace("AudioPlayer: skipped playing sound {} with name '{}'",
+                              std::to_underlying(si->uSoundID), si->sName);
             }
             break;
+        case SOUND_PLAYBACK_DROPPED:
+            logger->trace("AudioPlayer: dropped sound {}, out of voices", std::to_underlying(si->uSoundID));
+            break;
         case SOUND_PLAYBACK_SUCCEEDED:
             if (si->sName.empty()) {
-                logger->trace("AudioPlayer: playing sound {}", std::to_underlying(eSoundID));
+                logger->trace("AudioPlayer: playing sound {}", std::to_underlying(si->uSoundID));
             } else {
-                logger->trace("AudioPlayer: playing sound {} with name '{}'", std::to_underlying(eSoundID), si->sName);
+                logger->trace("AudioPlayer: playing sound {} with name '{}'",
+                              std::to_underlying(si->uSoundID), si->sName);
             }
             break;
         default:
@@ -346,31 +465,133 @@ void AudioPlayer::playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid) {
     }
 }
 
-bool AudioPlayer::loadSoundDataSource(SoundInfo* si) {
-    if (!si->dataSource) {
-        Blob buffer;
+PAudioDataSource AudioPlayer::loadSoundDataSource(SoundInfo* si) {
+    if (PAudioDataSource source = _soundCache.find(si->uSoundID))
+        return source;
 
-        if (si->sName == "") {  // enable this for bonus sound effects
-            //logger->Info("AudioPlayer: trying to load bonus sound {}", eSoundID);
-            //buffer = LoadSound(int(eSoundID));
-        } else {
-            buffer = LoadSound(si->sName);
+    if (!_pendingSounds.contains(si->uSoundID) && !startDecoding(si, engine->threadPool()))
+        return nullptr;
+
+    auto pos = _pendingSounds.find(si->uSoundID);
+    std::optional<DecodedAudio> audio = pos->second.get();
+    _pendingSounds.erase(pos);
+    return installDecodedSound(si, std::move(audio));
+}
+
+void AudioPlayer::preloadSounds(std::span<const SoundId> sounds, ThreadPool *pool) {
+    assert(pool);
+
+    if (!bPlayerReady)
+        return;
+
+    for (SoundId id : sounds) {
+        if (id == SOUND_Invalid || _pendingSounds.contains(id))
+            continue;
+
+        SoundInfo *si = pSoundList->soundInfo(id);
+        if (si && !_soundCache.contains(id))
+            startDecoding(si, pool);
+    }
+}
+
+void AudioPlayer::preloadLevelSounds(ThreadPool *pool) {
+    // Requests queued on the previous level reference objects that no longer exist.
+    _queuedSounds.clear();
+
+    std::vector<SoundId> sounds;
+    auto addSpellSounds = [&](SpellId spell) {
+        if (spell >= SPELL_FIRST_WITH_SPRITE && spell <= SPELL_LAST_WITH_SPRITE) {
+            sounds.push_back(static_cast<SoundId>(SpellSoundIds[spell]));
+            sounds.push_back(static_cast<SoundId>(SpellSoundIds[spell] + 1)); // Impact.
         }
+    };
+
+    for (const Actor &actor : pActors) {
+        for (SoundId sound : actor.soundSampleIds)
+            sounds.push_back(sound);
+        addSpellSounds(actor.monsterInfo.spell1Id);
+        addSpellSounds(actor.monsterInfo.spell2Id);
+    }
+
+    for (const Character &character : pParty->pCharacters)
+        for (SpellId spell : character.bHaveSpell.indices())
+            if (character.bHaveSpell[spell])
+                addSpellSounds(spell);
+
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        SoundId doorSound = doorSoundForMap(engine->_currentLoadedMapId);
+        sounds.push_back(doorSound);
+        sounds.push_back(doorClosedSound(doorSound));
+    }
+
+    std::ranges::sort(sounds);
+    auto [tail, _] = std::ranges::unique(sounds);
+    sounds.erase(tail, sounds.end());
+
+    preloadSounds(sounds, pool);
+    logger->trace("AudioPlayer: decoding {} sounds in background", _pendingSounds.size());
+}
+
+bool AudioPlayer::startDecoding(SoundInfo *si, ThreadPool *pool) {
+    assert(!_soundCache.contains(si->uSoundID) && !_pendingSounds.contains(si->uSoundID));
+
+    // Sounds with an empty name are bonus sound effects that aren't in the sound archive.
+    if (si->sName.empty() || !_sndReader.exists(si->sName)) {
+        logger->warning("AudioPlayer: failed to load sound {} ({})", std::to_underlying(si->uSoundID), si->sName);
+        return false;
+    }
 
-        if (!buffer) {
-            logger->warning("AudioPlayer: failed to load sound {} ({})", std::to_underlying(si->uSoundID), si->sName);
-            return false;
+    // SndReader::read is const & doesn't touch any shared state, so it's safe to call it from the worker thread.
+    _pendingSounds.emplace(si->uSoundID, pool->submit([this, name = si->sName] {
+        return decodeAudio(_sndReader.read(name));
+    }));
+    return true;
+}
+
+PAudioDataSource AudioPlayer::installDecodedSound(SoundInfo *si, std::optional<DecodedAudio> audio) {
+    if (!audio) {
+        logger->warning("AudioPlayer: failed to create sound data source {} ({})",
+                        std::to_underlying(si->uSoundID), si->sName);
+        return nullptr;
+    }
+
+    return _soundCache.insert(si->uSoundID, std::move(*audio));
+}
+
+void AudioPlayer::collectDecodedSounds() {
+    for (auto pos = _pendingSounds.begin(); pos != _pendingSounds.end();) {
+        if (pos->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            ++pos;
+            continue;
         }
 
-        si->dataSource = CreateAudioBufferDataSource(std::move(buffer));
-        if (!si->dataSource) {
-            logger->warning("AudioPlayer: failed to create sound data source {} ({})", std::to_underlying(si->uSoundID), si->sName);
-            return false;
+        installDecodedSound(pSoundList->soundInfo(pos->first), pos->second.get());
+        pos = _pendingSounds.erase(pos);
+    }
+}
+
+void AudioPlayer::playQueuedSounds() {
+    std::vector<QueuedSound> queuedSounds = std::move(_queuedSounds);
+    _queuedSounds.clear();
+
+    for (const QueuedSound &queued : queuedSounds) {
+        if (_pendingSounds.contains(queued.id)) {
+            _queuedSounds.push_back(queued);
+            continue;
         }
 
-        si->dataSource = PlatformDataSourceInitialize(si->dataSource);
+        // Not there if decoding failed (already logged), or if it was evicted right away because the budget is tiny.
+        PAudioDataSource source = _soundCache.find(queued.id);
+        if (!source)
+            continue;
+
+        SoundInfo *si = pSoundList->soundInfo(queued.id);
+        logPlaybackResult(si, startSound(si, source, queued.mode, queued.pid));
     }
-    return true;
+}
+
+void AudioPlayer::dropQueuedSounds(const std::function<bool(const QueuedSound &)> &filter) {
+    std::erase_if(_queuedSounds, filter);
 }
 
 void AudioPlayer::UpdateSounds() {
@@ -380,25 +601,38 @@ void AudioPlayer::UpdateSounds() {
     provider->SetOrientation(yaw, pitch);
     provider->SetListenerPosition(pParty->pos.x, pParty->pos.y, pParty->pos.z);
 
-    _voiceSoundPool.update();
-    _regularSoundPool.update();
-    _loopingSoundPool.update();
+    // Virtual voices are advanced in real time, same as the sounds that OpenAL is actually playing.
+    auto now = std::chrono::steady_clock::now();
+    float elapsed = 0.0f;
+    if (_lastUpdateTime != std::chrono::steady_clock::time_point())
+        elapsed = std::chrono::duration<float>(now - _lastUpdateTime).count();
+    _lastUpdateTime = now;
+
+    _regularSoundPool.setListenerPosition(pParty->pos);
+    _loopingSoundPool.setListenerPosition(pParty->pos);
+
+    _voiceSoundPool.update(elapsed);
+    _regularSoundPool.update(elapsed, &soundSourcePosition);
+    _loopingSoundPool.update(elapsed, &soundSourcePosition);
+    _walkingSoundPool.update(elapsed);
+
+    // Stopped samples were released above, so sounds that just finished playing can be evicted.
+    _soundCache.setBudget(static_cast<size_t>(engine->config->audio.SoundCacheBudget.value()) * 1024 * 1024);
+    _soundCache.trim();
+
+    collectDecodedSounds();
+    playQueuedSounds();
 
     if (current_screen_type != SCREEN_GAME) {
         stopWalkingSounds();
     }
-    if (_currentWalkingSample && _currentWalkingSample->IsStopped()) {
-        _currentWalkingSample = nullptr;
-    }
 }
 
 void AudioPlayer::pauseAllSounds() {
     _voiceSoundPool.pause();
     _regularSoundPool.pause();
     _loopingSoundPool.pause();
-    if (_currentWalkingSample) {
-        _currentWalkingSample->Pause();
-    }
+    _walkingSoundPool.pause();
 }
 
 void AudioPlayer::pauseLooping() {
@@ -416,11 +650,35 @@ void AudioPlayer::soundDrain() {
     }
 }
 
-bool AudioPlayer::isWalkingSoundPlays() {
-    if (_currentWalkingSample) {
-        return !_currentWalkingSample->IsStopped();
+AudioSamplePoolStats AudioPlayer::voicePoolStats() const {
+    AudioSamplePoolStats result;
+    for (const AudioSamplePool *pool : {&_voiceSoundPool, &_regularSoundPool, &_loopingSoundPool, &_walkingSoundPool}) {
+        const AudioSamplePoolStats &stats = pool->frameStats();
+        result.voices += stats.voices;
+        result.virtualVoices += stats.virtualVoices;
+        result.peakVoices += stats.peakVoices;
+        result.started += stats.started;
+        result.stolen += stats.stolen;
+        result.promoted += stats.promoted;
+        result.demoted += stats.demoted;
+        result.dropped += stats.dropped;
     }
-    return false;
+    return result;
+}
+
+size_t AudioPlayer::voicePoolCapacity() const {
+    return _voiceSoundPool.capacity() + _regularSoundPool.capacity() + _loopingSoundPool.capacity() +
+           _walkingSoundPool.capacity();
+}
+
+bool AudioPlayer::isWalkingSoundPlays() {
+    if (_walkingSoundPool.hasPlaying())
+        return true;
+
+    // Walking sound that's waiting to be decoded counts as playing, otherwise we'll be queueing it every frame.
+    return std::ranges::any_of(_queuedSounds, [](const QueuedSound &queued) {
+        return queued.mode == SOUND_MODE_WALKING;
+    });
 }
 
 float AudioPlayer::getSoundLength(SoundId eSoundID) {
@@ -430,23 +688,24 @@ float AudioPlayer::getSoundLength(SoundId eSoundID) {
         return 0.0f;
     }
 
-    if (!si->dataSource) {
-        // if the sound hasnt been used before - load it
-        if (!loadSoundDataSource(si)) return 0.0f;
-
-        // then force the sample to load/play to save codec info
-        PAudioSample sample = CreateAudioSample();
-        sample->SetVolume(0);
-        _regularSoundPool.playNew(sample, si->dataSource);
-    }
+    PAudioDataSource source = loadSoundDataSource(si);
+    if (!source)
+        return 0.0f;
 
-     return si->dataSource->GetDuration();
+    return source->GetDuration();
 }
 
 void AudioPlayer::Initialize() {
+    assert(provider); // Pools need an OpenAL context to create their voices.
+
     currentMusicTrack = MUSIC_INVALID;
     uMasterVolume = 127;
 
+    _voiceSoundPool.initialize();
+    _regularSoundPool.initialize();
+    _loopingSoundPool.initialize();
+    _walkingSoundPool.initialize();
+
     UpdateVolumeFromConfig();
     _sndReader.open(dfs->read("sounds/audio.snd"));
 
@@ -465,15 +724,6 @@ void PlayLevelMusic() {
     }
 }
 
-Blob AudioPlayer::LoadSound(std::string_view pSoundName) {
-    if (!_sndReader.exists(pSoundName)) {
-        logger->warning("AudioPlayer: {} can't load sound header!", pSoundName);
-        return Blob();
-    }
-
-    return _sndReader.read(pSoundName);
-}
-
 void AudioPlayer::playSpellSound(SpellId spell, bool is_impact, SoundPlaybackMode mode, Pid pid) {
     if (spell != SPELL_NONE)
         playSound(static_cast<SoundId>(SpellSoundIds[spell] + is_impact), mode, pid);
@@ -1,12 +1,20 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <memory>
+#include <functional>
+#include <future>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
 #include "Engine/Pid.h"
 #include "Engine/Spells/SpellEnums.h"
 
 #include "Media/AudioTrack.h"
+#include "Media/AudioPcmDataSource.h"
 
 #include "Library/Snd/SndReader.h"
 
@@ -14,8 +22,11 @@
 
 #include "SoundEnums.h"
 #include "AudioSamplePool.h"
+#include "SoundCache.h"
 #include "SoundInfo.h"
 
+class ThreadPool;
+
 class AudioPlayer {
  public:
     AudioPlayer() = default;
@@ -24,8 +35,6 @@ class AudioPlayer {
     void Initialize();
     void UpdateVolumeFromConfig();
 
-    Blob LoadSound(std::string_view pSoundName);
-
     void SetMasterVolume(int level);
     void SetVoiceVolume(int level);
     void SetMusicVolume(int level);
@@ -56,6 +65,10 @@ class AudioPlayer {
     /**
      * Play sound.
      *
+     * This function never waits for the sound to be decoded. If the sound is not decoded yet, then decoding is started
+     * on the engine's thread pool, and the request is queued & played from `UpdateSounds` once the sound is ready.
+     * Requests for unique sounds that are already playing or queued are skipped.
+     *
      * @param eSoundID                  ID of sound.
      * @param mode                      Playback mode.
      * @param pid                       `Pid` of sound source.
@@ -63,11 +76,52 @@ class AudioPlayer {
     void playSound(SoundId eSoundID, SoundPlaybackMode mode, Pid pid = Pid());
 
     /**
-     * Checks that data source has been populated and if not loads it into SoundInfo. Returns true on success
+     * Looks up the provided sound in the sound cache, and if it's not there, decodes it & puts it into the cache.
+     * Unlike `playSound`, this function blocks until the sound is decoded.
      *
      * @param si                        SoundInfo to be loaded
+     * @return                          Data source for the sound, or `nullptr` on error.
+     */
+    PAudioDataSource loadSoundDataSource(SoundInfo* si);
+
+    /**
+     * Starts decoding the provided sounds on the provided thread pool. Decoded sounds are picked up in
+     * `UpdateSounds`. Sounds that are already decoded or are being decoded are skipped.
+     *
+     * @param sounds                    Sounds to decode.
+     * @param pool                      Thread pool to use.
+     */
+    void preloadSounds(std::span<const SoundId> sounds, ThreadPool *pool);
+
+    /**
+     * Starts decoding all the sounds that the current level is likely to need - monster sounds, sounds of the spells
+     * that monsters and party members can cast, and door sounds. Meant to be called during level loading, after the
+     * actors are spawned.
+     *
+     * @param pool                      Thread pool to use.
      */
-    bool loadSoundDataSource(SoundInfo* si);
+    void preloadLevelSounds(ThreadPool *pool);
+
+    /**
+     * @return                          Statistics for the decoded sounds cache.
+     */
+    [[nodiscard]] const SoundCacheStats &soundCacheStats() const {
+        return _soundCache.stats();
+    }
+
+    [[nodiscard]] size_t soundCacheBudget() const {
+        return _soundCache.budget();
+    }
+
+    /**
+     * @return                          Voice counters for the last frame, summed over all sample pools.
+     */
+    [[nodiscard]] AudioSamplePoolStats voicePoolStats() const;
+
+    /**
+     * @return                          Total number of voices in all sample pools.
+     */
+    [[nodiscard]] size_t voicePoolCapacity() const;
 
     /**
      * Play sound of spell casting or spell sprite impact.
@@ -139,6 +193,36 @@ class AudioPlayer {
         playSound(id, isSpeech ? SOUND_MODE_HOUSE_SPEECH : SOUND_MODE_HOUSE_DOOR);
     }
 
+ protected:
+    struct QueuedSound {
+        SoundId id;
+        SoundPlaybackMode mode;
+        Pid pid;
+    };
+
+    /**
+     * Uniqueness slot of a sound request in one of the sample pools. Only one sound can play in a slot at a time.
+     */
+    struct SoundSlot {
+        AudioSamplePool *pool = nullptr; // `nullptr` if the request is not unique.
+        SoundId id = SOUND_Invalid; // Either this one is set...
+        Pid pid; // ...or this one.
+        bool restarts = false; // Whether the request stops the sound in the slot, instead of being skipped.
+    };
+
+    /**
+     * @return                          Slot that `startSound` would use for the provided request.
+     */
+    SoundSlot soundSlot(SoundId id, SoundPlaybackMode mode, Pid pid);
+    bool isSlotPlaying(const SoundSlot &slot);
+    SoundPlaybackResult startSound(SoundInfo *si, const PAudioDataSource &source, SoundPlaybackMode mode, Pid pid);
+    void logPlaybackResult(SoundInfo *si, SoundPlaybackResult result);
+    bool startDecoding(SoundInfo *si, ThreadPool *pool);
+    PAudioDataSource installDecodedSound(SoundInfo *si, std::optional<DecodedAudio> audio);
+    void collectDecodedSounds();
+    void playQueuedSounds();
+    void dropQueuedSounds(const std::function<bool(const QueuedSound &)> &filter);
+
  protected:
     bool bPlayerReady = false;
     MusicId currentMusicTrack = MUSIC_INVALID;
@@ -147,11 +231,16 @@ class AudioPlayer {
     float uVoiceVolume = 0;
     PAudioTrack pCurrentMusicTrack;
 
-    AudioSamplePool _voiceSoundPool = AudioSamplePool(false);
-    AudioSamplePool _regularSoundPool = AudioSamplePool(false);
-    AudioSamplePool _loopingSoundPool = AudioSamplePool(true);
-    PAudioSample _currentWalkingSample;
+    // Must be declared before the sample pools, playing samples reference the memory owned by the cache.
+    SoundCache _soundCache;
+    AudioSamplePool _voiceSoundPool = AudioSamplePool(false, 8);
+    AudioSamplePool _regularSoundPool = AudioSamplePool(false, 64);
+    AudioSamplePool _loopingSoundPool = AudioSamplePool(true, 32);
+    AudioSamplePool _walkingSoundPool = AudioSamplePool(false, 1);
     SndReader _sndReader;
+    std::unordered_map<SoundId, std::future<std::optional<DecodedAudio>>> _pendingSounds;
+    std::vector<QueuedSound> _queuedSounds;
+    std::chrono::steady_clock::time_point _lastUpdateTime; // Time of the last `UpdateSounds` call.
 };
 
 extern std::unique_ptr<AudioPlayer> pAudioPlayer;
@@ -1,110 +1,399 @@
 #include "AudioSamplePool.h"
 
-SoundPlaybackResult AudioSamplePool::playNew(PAudioSample sample, PAudioDataSource source, bool positional) {
-    update();
-    if (!sample->Open(source)) {
-        return SOUND_PLAYBACK_FAILED;
-    }
-    sample->Play(_looping, positional);
-    _samplePool.push_back(AudioSamplePoolEntry(sample, SOUND_Invalid, Pid()));
-    return SOUND_PLAYBACK_SUCCEEDED;
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "Library/Logger/Logger.h"
+
+#include "OpenALSample16.h"
+#include "OpenALSoundProvider.h"
+
+// Voices go virtual a bit farther away than they are promoted, so that sounds moving around the threshold don't
+// flip between real & virtual every frame.
+static constexpr float DEMOTE_SOUND_DIST = VIRTUAL_SOUND_DIST * 1.1f;
+
+AudioSamplePool::AudioSamplePool(bool looping, size_t capacity, SampleFactory factory) :
+    _looping(looping), _requestedCapacity(capacity), _factory(std::move(factory)) {
+    assert(capacity > 0);
+
+    if (!_factory)
+        _factory = &CreateAudioSample;
+
+    // Free lists are used as stacks, so the first sample & voice are handed out first.
+    size_t voiceCapacity = capacity * VIRTUAL_VOICE_RATIO;
+    _voices.resize(voiceCapacity);
+    for (size_t i = voiceCapacity; i > 0; i--)
+        _freeVoices.push_back(i - 1);
+    _activeVoices.reserve(voiceCapacity);
 }
 
-SoundPlaybackResult AudioSamplePool::playUniqueSoundId(PAudioSample sample, PAudioDataSource source, SoundId id, bool positional) {
-    update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        if (entry.id == id) {
-            return SOUND_PLAYBACK_SKIPPED;
-        }
-    }
-    if (!sample->Open(source)) {
-        return SOUND_PLAYBACK_FAILED;
+AudioSamplePool::~AudioSamplePool() = default;
+
+void AudioSamplePool::initialize() {
+    assert(_samples.empty());
+
+    _samples.reserve(_requestedCapacity);
+    while (_samples.size() < _requestedCapacity) {
+        PAudioSample sample = _factory();
+        if (!sample)
+            break;
+        _samples.push_back(std::move(sample));
     }
-    sample->Play(_looping, positional);
-    _samplePool.push_back(AudioSamplePoolEntry(sample, id, Pid()));
-    return SOUND_PLAYBACK_SUCCEEDED;
+
+    if (_samples.size() < _requestedCapacity)
+        logger->warning("AudioSamplePool: could only create {} out of {} voices", _samples.size(), _requestedCapacity);
+
+    // Same as with the voices, first sample is handed out first.
+    for (size_t i = _samples.size(); i > 0; i--)
+        _freeSamples.push_back(i - 1);
 }
 
-SoundPlaybackResult AudioSamplePool::playUniquePid(PAudioSample sample, PAudioDataSource source, Pid pid, bool positional) {
-    update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        if (entry.pid == pid) {
-            return SOUND_PLAYBACK_SKIPPED;
-        }
-    }
-    if (!sample->Open(source)) {
-        return SOUND_PLAYBACK_FAILED;
-    }
-    sample->Play(_looping, positional);
-    _samplePool.push_back(AudioSamplePoolEntry(sample, SOUND_Invalid, pid));
-    return SOUND_PLAYBACK_SUCCEEDED;
+SoundPlaybackResult AudioSamplePool::playNew(PAudioDataSource source, const SoundPlaybackParams &params) {
+    return play(std::move(source), SOUND_Invalid, Pid(), params);
+}
+
+SoundPlaybackResult AudioSamplePool::playUniqueSoundId(PAudioDataSource source, SoundId id,
+                                                       const SoundPlaybackParams &params) {
+    assert(id != SOUND_Invalid);
+    return play(std::move(source), id, Pid(), params);
+}
+
+SoundPlaybackResult AudioSamplePool::playUniquePid(PAudioDataSource source, Pid pid,
+                                                   const SoundPlaybackParams &params) {
+    assert(pid != Pid());
+    return play(std::move(source), SOUND_Invalid, pid, params);
 }
 
 void AudioSamplePool::pause() {
-    update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->Pause();
+    releaseStoppedVoices();
+    for (size_t index : _activeVoices) {
+        Voice &voice = _voices[index];
+        voice.paused = true;
+        if (voice.sample)
+            _samples[*voice.sample]->Pause();
     }
 }
 
 void AudioSamplePool::resume() {
-    update();
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->Resume();
+    releaseStoppedVoices();
+    for (size_t index : _activeVoices) {
+        Voice &voice = _voices[index];
+        voice.paused = false;
+        if (voice.sample)
+            _samples[*voice.sample]->Resume();
     }
 }
 
 void AudioSamplePool::stop() {
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->Stop();
-    }
-    _samplePool.clear();
+    while (!_activeVoices.empty())
+        releaseVoice(_activeVoices.back());
+    updateVoiceCounts();
 }
 
 void AudioSamplePool::stopSoundId(SoundId soundId) {
     assert(soundId != SOUND_Invalid);
 
-    auto it = _samplePool.begin();
-    while (it != _samplePool.end()) {
-        if ((*it).id == soundId) {
-            (*it).samplePtr->Stop();
-            it = _samplePool.erase(it);
-        } else {
-            it++;
-        }
-    }
+    auto pos = _voiceBySoundId.find(soundId);
+    if (pos != _voiceBySoundId.end())
+        releaseVoice(pos->second);
+    updateVoiceCounts();
 }
 
 void AudioSamplePool::stopPid(Pid pid) {
     assert(pid != Pid());
 
-    auto it = _samplePool.begin();
-    while (it != _samplePool.end()) {
-        if ((*it).pid == pid) {
-            (*it).samplePtr->Stop();
-            it = _samplePool.erase(it);
-        } else {
-            it++;
+    auto pos = _voiceByPid.find(pid.packed());
+    if (pos != _voiceByPid.end())
+        releaseVoice(pos->second);
+    updateVoiceCounts();
+}
+
+bool AudioSamplePool::hasSoundId(SoundId soundId) {
+    assert(soundId != SOUND_Invalid);
+
+    releaseStoppedVoices();
+    return _voiceBySoundId.contains(soundId);
+}
+
+bool AudioSamplePool::hasPid(Pid pid) {
+    assert(pid != Pid());
+
+    releaseStoppedVoices();
+    return _voiceByPid.contains(pid.packed());
+}
+
+void AudioSamplePool::update(float elapsed, const SoundPositionResolver &positionOf) {
+    releaseStoppedVoices();
+
+    for (size_t i = _activeVoices.size(); i > 0; i--) {
+        size_t index = _activeVoices[i - 1];
+        Voice &voice = _voices[index];
+
+        if (positionOf && voice.params.positional && voice.params.owner != Pid()) {
+            if (std::optional<Vec3f> position = positionOf(voice.params.owner)) {
+                voice.params.position = *position;
+                if (voice.sample)
+                    _samples[*voice.sample]->SetPosition(position->x, position->y, position->z, MAX_SOUND_DIST);
+            }
+        }
+
+        if (!voice.paused)
+            voice.elapsed += elapsed;
+        if (_looping && voice.duration > 0)
+            voice.elapsed = std::fmod(voice.elapsed, voice.duration);
+
+        if (!voice.sample) {
+            // Virtual voices finish when their sound would have finished playing. We can't track sounds of unknown
+            // duration, so these are dropped right away.
+            if (!_looping && voice.elapsed >= voice.duration)
+                releaseVoice(index);
+        } else if (!isAudible(voice, DEMOTE_SOUND_DIST)) {
+            virtualize(index);
+            _stats.demoted++;
         }
     }
-}
 
-void AudioSamplePool::update() {
-    auto it = _samplePool.begin();
-    std::erase_if(_samplePool, [](const AudioSamplePoolEntry& entry) { return entry.samplePtr->IsStopped(); });
+    promoteVoices();
+    updateVoiceCounts();
+
+    _frameStats = _stats;
+    _stats = AudioSamplePoolStats();
+    updateVoiceCounts();
 }
 
 void AudioSamplePool::setVolume(float value) {
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        entry.samplePtr->SetVolume(value);
+    for (size_t index : _activeVoices) {
+        Voice &voice = _voices[index];
+        voice.params.volume = value;
+        if (voice.sample)
+            _samples[*voice.sample]->SetVolume(value);
     }
 }
 
 bool AudioSamplePool::hasPlaying() {
-    for (AudioSamplePoolEntry &entry : _samplePool) {
-        if (!entry.samplePtr->IsStopped()) {
+    for (size_t index : _activeVoices) {
+        const Voice &voice = _voices[index];
+        if (voice.sample && !_samples[*voice.sample]->IsStopped())
             return true;
-        }
     }
     return false;
 }
+
+SoundPlaybackResult AudioSamplePool::play(PAudioDataSource source, SoundId id, Pid pid,
+                                          const SoundPlaybackParams &params) {
+    releaseStoppedVoices();
+
+    if (id != SOUND_Invalid && _voiceBySoundId.contains(id))
+        return SOUND_PLAYBACK_SKIPPED;
+    if (pid != Pid() && _voiceByPid.contains(pid.packed()))
+        return SOUND_PLAYBACK_SKIPPED;
+
+    std::optional<size_t> index = acquireVoice(params);
+    if (!index) {
+        _stats.dropped++;
+        return SOUND_PLAYBACK_DROPPED;
+    }
+
+    Voice &voice = _voices[*index];
+    voice.duration = source->GetDuration();
+    voice.source = std::move(source);
+    voice.id = id;
+    voice.pid = pid;
+    voice.params = params;
+    voice.elapsed = 0;
+    voice.paused = false;
+    voice.serial = _nextSerial++;
+    voice.sample = std::nullopt;
+    voice.activeIndex = _activeVoices.size();
+    _activeVoices.push_back(*index);
+    if (id != SOUND_Invalid)
+        _voiceBySoundId.emplace(id, *index);
+    if (pid != Pid())
+        _voiceByPid.emplace(pid.packed(), *index);
+
+    // Sounds that can't be heard, or that lost to more important sounds, start out virtual.
+    if (isAudible(voice, VIRTUAL_SOUND_DIST)) {
+        if (std::optional<size_t> sample = acquireSample(rank(params), true)) {
+            if (!startSample(*index, *sample)) {
+                releaseVoice(*index);
+                return SOUND_PLAYBACK_FAILED;
+            }
+        }
+    }
+
+    _stats.started++;
+    updateVoiceCounts();
+    return SOUND_PLAYBACK_SUCCEEDED;
+}
+
+std::optional<size_t> AudioSamplePool::acquireVoice(const SoundPlaybackParams &params) {
+    if (_freeVoices.empty()) {
+        // Among equals, older voices go first.
+        auto voiceRank = [&](const Voice &voice) {
+            return std::pair(rank(voice.params), voice.serial);
+        };
+
+        size_t victim = _activeVoices[0];
+        for (size_t index : _activeVoices)
+            if (voiceRank(_voices[index]) < voiceRank(_voices[victim]))
+                victim = index;
+
+        // Don't drop voices that are more important than the new sound. New sound wins the ties.
+        if (rank(params) < rank(_voices[victim].params))
+            return std::nullopt;
+
+        releaseVoice(victim);
+        _stats.dropped++;
+    }
+
+    size_t result = _freeVoices.back();
+    _freeVoices.pop_back();
+    return result;
+}
+
+std::optional<size_t> AudioSamplePool::acquireSample(Rank newRank, bool winTies) {
+    if (_samples.empty())
+        return std::nullopt; // Not initialized, or no voices could be created.
+
+    if (_freeSamples.empty()) {
+        auto voiceRank = [&](const Voice &voice) {
+            return std::pair(rank(voice.params), voice.serial);
+        };
+
+        std::optional<size_t> victim;
+        for (size_t index : _activeVoices)
+            if (_voices[index].sample && (!victim || voiceRank(_voices[index]) < voiceRank(_voices[*victim])))
+                victim = index;
+        assert(victim);
+
+        Rank victimRank = rank(_voices[*victim].params);
+        if (winTies ? newRank < victimRank : newRank <= victimRank)
+            return std::nullopt;
+
+        virtualize(*victim);
+        _stats.stolen++;
+    }
+
+    size_t result = _freeSamples.back();
+    _freeSamples.pop_back();
+    return result;
+}
+
+bool AudioSamplePool::startSample(size_t index, size_t sample) {
+    Voice &voice = _voices[index];
+    IAudioSample *audioSample = _samples[sample].get();
+
+    audioSample->SetVolume(voice.params.volume);
+    if (voice.params.positional) {
+        Vec3f position = voice.params.position;
+        audioSample->SetPosition(position.x, position.y, position.z, MAX_SOUND_DIST);
+    }
+
+    if (!audioSample->Open(voice.source)) {
+        audioSample->Unload();
+        _freeSamples.push_back(sample);
+        return false;
+    }
+    if (voice.elapsed > 0)
+        audioSample->Seek(voice.elapsed);
+    audioSample->Play(_looping, voice.params.positional);
+
+    voice.sample = sample;
+    return true;
+}
+
+void AudioSamplePool::virtualize(size_t index) {
+    Voice &voice = _voices[index];
+    assert(voice.sample);
+
+    _samples[*voice.sample]->Unload();
+    _freeSamples.push_back(*voice.sample);
+    voice.sample = std::nullopt;
+}
+
+void AudioSamplePool::promoteVoices() {
+    std::vector<size_t> candidates;
+    for (size_t index : _activeVoices) {
+        const Voice &voice = _voices[index];
+        if (!voice.sample && !voice.paused && isAudible(voice, VIRTUAL_SOUND_DIST))
+            candidates.push_back(index);
+    }
+    if (candidates.empty())
+        return;
+
+    // Most important voices go first.
+    auto voiceRank = [&](size_t index) {
+        return std::pair(rank(_voices[index].params), _voices[index].serial);
+    };
+    std::ranges::sort(candidates, [&](size_t l, size_t r) {
+        return voiceRank(r) < voiceRank(l);
+    });
+
+    for (size_t index : candidates) {
+        // Promoted voices don't win the ties, otherwise two equally important sounds would keep stealing the voice
+        // from each other.
+        std::optional<size_t> sample = acquireSample(rank(_voices[index].params), false);
+        if (!sample)
+            break; // Everything else is even less important.
+
+        if (startSample(index, *sample)) {
+            _stats.promoted++;
+        } else {
+            releaseVoice(index);
+        }
+    }
+}
+
+void AudioSamplePool::releaseVoice(size_t index) {
+    Voice &voice = _voices[index];
+    if (voice.sample)
+        virtualize(index);
+    voice.source = nullptr;
+
+    if (voice.id != SOUND_Invalid)
+        _voiceBySoundId.erase(voice.id);
+    if (voice.pid != Pid())
+        _voiceByPid.erase(voice.pid.packed());
+    voice.id = SOUND_Invalid;
+    voice.pid = Pid();
+
+    size_t last = _activeVoices.back();
+    _activeVoices[voice.activeIndex] = last;
+    _voices[last].activeIndex = voice.activeIndex;
+    _activeVoices.pop_back();
+
+    _freeVoices.push_back(index);
+}
+
+void AudioSamplePool::releaseStoppedVoices() {
+    for (size_t i = _activeVoices.size(); i > 0; i--) {
+        size_t index = _activeVoices[i - 1];
+        const Voice &voice = _voices[index];
+        if (voice.sample && _samples[*voice.sample]->IsStopped())
+            releaseVoice(index);
+    }
+    updateVoiceCounts();
+}
+
+AudioSamplePool::Rank AudioSamplePool::rank(const SoundPlaybackParams &params) const {
+    // Voices are ranked by priority, and then by distance to the listener.
+    float distance = params.positional ? (params.position - _listenerPosition).length() : 0.0f;
+    return Rank(params.priority, -distance);
+}
+
+bool AudioSamplePool::isAudible(const Voice &voice, float maxDistance) const {
+    return !voice.params.positional || (voice.params.position - _listenerPosition).length() <= maxDistance;
+}
+
+size_t AudioSamplePool::realVoiceCount() const {
+    return _samples.size() - _freeSamples.size();
+}
+
+void AudioSamplePool::updateVoiceCounts() {
+    _stats.voices = realVoiceCount();
+    _stats.virtualVoices = _activeVoices.size() - _stats.voices;
+    _stats.peakVoices = std::max(_stats.peakVoices, _stats.voices);
+}
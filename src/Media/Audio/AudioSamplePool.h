@@ -1,37 +1,195 @@
 #pragma once
 
-#include <list>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "Engine/Pid.h"
 
+#include "Library/Geometry/Vec.h"
+
 #include "Media/AudioSample.h"
 
 #include "SoundEnums.h"
 
-struct AudioSamplePoolEntry {
-    AudioSamplePoolEntry(PAudioSample samplePtr, SoundId id, Pid pid) : samplePtr(samplePtr), id(id), pid(pid) {}
+/**
+ * Per-frame counters for `AudioSamplePool`.
+ */
+struct AudioSamplePoolStats {
+    size_t voices = 0; // Number of real voices that were playing at the end of the frame.
+    size_t virtualVoices = 0; // Number of virtual voices at the end of the frame.
+    size_t peakVoices = 0; // Max number of real voices that were playing at once during the frame.
+    size_t started = 0; // Number of sounds started during the frame, including the ones started as virtual.
+    size_t stolen = 0; // Number of real voices taken over by more important sounds during the frame.
+    size_t promoted = 0; // Number of virtual voices that got a real voice during the frame.
+    size_t demoted = 0; // Number of real voices that went virtual during the frame because they became inaudible.
+    size_t dropped = 0; // Number of sounds dropped during the frame because the pool was full.
+};
 
-    PAudioSample samplePtr;
-    SoundId id;
-    Pid pid;
+/**
+ * Playback parameters for a sound started in an `AudioSamplePool`.
+ */
+struct SoundPlaybackParams {
+    float volume = 1.0f;
+    SoundPriority priority = SOUND_PRIORITY_INTERFACE;
+    bool positional = false;
+    Vec3f position; // Sound position in world coordinates, only used for positional sounds.
+    Pid owner; // Object that's emitting the sound, positional sounds follow it. Can be empty.
 };
 
+/**
+ * Callback that returns the current position of a sound emitting object, or `std::nullopt` if it's not known.
+ */
+using SoundPositionResolver = std::function<std::optional<Vec3f>(Pid)>;
+
+/**
+ * Fixed-capacity pool of voices.
+ *
+ * Every sound played through the pool gets a logical voice. A logical voice is either real, i.e. backed by one of the
+ * audio samples that the pool creates in `initialize`, or virtual. Virtual voices are tracked & have their playback position
+ * advanced in `update`, but don't use any OpenAL resources. Starting a sound doesn't allocate anything. Lookups by
+ * `SoundId` and by `Pid` are O(1).
+ *
+ * Positional sounds that are too far from the listener to be heard are virtual. They are promoted to real voices
+ * once they become audible, and continue playing from where they would be had they been real all along.
+ *
+ * When all real voices are busy, the least important one is stolen and goes virtual. Importance is decided by
+ * priority first, and then by distance to the listener. When all logical voices are busy too, the least important
+ * logical voice is dropped. If everything that's playing is more important than the new sound, the new sound is
+ * dropped instead.
+ */
 class AudioSamplePool {
  public:
-    explicit AudioSamplePool(bool looping):_looping(looping) {}
+    using SampleFactory = std::function<PAudioSample()>;
+
+    /** Number of logical voices per real voice. */
+    static constexpr size_t VIRTUAL_VOICE_RATIO = 4;
+
+    /**
+     * @param looping                   Whether the sounds played through this pool should be looped.
+     * @param capacity                  Max number of sounds that can be heard at the same time.
+     * @param factory                   Factory for the voices, `nullptr` means OpenAL voices. Factory can return
+     *                                  `nullptr` if it's out of platform resources.
+     */
+    AudioSamplePool(bool looping, size_t capacity, SampleFactory factory = nullptr);
+    ~AudioSamplePool();
 
-    SoundPlaybackResult playNew(PAudioSample sample, PAudioDataSource source, bool positional = false);
-    SoundPlaybackResult playUniqueSoundId(PAudioSample sample, PAudioDataSource source, SoundId id, bool positional = false);
-    SoundPlaybackResult playUniquePid(PAudioSample sample, PAudioDataSource source, Pid pid, bool positional = false);
+    /**
+     * Creates the real voices. For OpenAL voices this must be called after the OpenAL context is created. Until this
+     * is called, all sounds played through the pool are virtual.
+     *
+     * If the factory fails to create all the requested voices, the pool logs a warning and shrinks its capacity to
+     * the number of voices that were created.
+     */
+    void initialize();
+
+    AudioSamplePool(const AudioSamplePool &) = delete;
+    AudioSamplePool &operator=(const AudioSamplePool &) = delete;
+
+    SoundPlaybackResult playNew(PAudioDataSource source, const SoundPlaybackParams &params);
+    SoundPlaybackResult playUniqueSoundId(PAudioDataSource source, SoundId id, const SoundPlaybackParams &params);
+    SoundPlaybackResult playUniquePid(PAudioDataSource source, Pid pid, const SoundPlaybackParams &params);
     void pause();
     void resume();
     void stop();
     void stopSoundId(SoundId soundId);
     void stopPid(Pid pid);
-    void update();
+
+    /**
+     * @param soundId                   Sound id to check.
+     * @return                          Whether a sound started with `playUniqueSoundId` with the provided id is still
+     *                                  playing, either on a real or on a virtual voice.
+     */
+    bool hasSoundId(SoundId soundId);
+
+    /**
+     * @param pid                       Pid to check.
+     * @return                          Whether a sound started with `playUniquePid` with the provided pid is still
+     *                                  playing, either on a real or on a virtual voice.
+     */
+    bool hasPid(Pid pid);
+
+    /**
+     * Releases the voices that have finished playing, updates sound positions, moves voices between real & virtual,
+     * and finishes the current frame for the purpose of collecting the stats. Meant to be called once per frame.
+     *
+     * @param elapsed                   Time since the last call, in seconds. Used to advance the virtual voices.
+     * @param positionOf                Callback to get the current positions of sound emitting objects. If not
+     *                                  provided, sound positions are not updated.
+     */
+    void update(float elapsed = 0.0f, const SoundPositionResolver &positionOf = nullptr);
     void setVolume(float value);
+
+    /**
+     * @return                          Whether any of the real voices are playing. Virtual voices can't be heard, so
+     *                                  they are not taken into account.
+     */
     bool hasPlaying();
+
+    /**
+     * @param position                  Listener position, used to decide which voices to make virtual.
+     */
+    void setListenerPosition(Vec3f position) {
+        _listenerPosition = position;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return _samples.size();
+    }
+
+    /**
+     * @return                          Stats for the last frame finished with a call to `update`.
+     */
+    [[nodiscard]] const AudioSamplePoolStats &frameStats() const {
+        return _frameStats;
+    }
+
+ private:
+    struct Voice {
+        PAudioDataSource source;
+        SoundId id = SOUND_Invalid;
+        Pid pid;
+        SoundPlaybackParams params;
+        float duration = 0; // Sound duration in seconds, zero if unknown.
+        float elapsed = 0; // Playback position in seconds.
+        bool paused = false;
+        uint64_t serial = 0; // Start order, older voices go first.
+        std::optional<size_t> sample; // Index in `_samples`, `std::nullopt` for virtual voices.
+        size_t activeIndex = 0; // Index in `_activeVoices`.
+    };
+
+    using Rank = std::pair<SoundPriority, float>;
+
+    SoundPlaybackResult play(PAudioDataSource source, SoundId id, Pid pid, const SoundPlaybackParams &params);
+    std::optional<size_t> acquireVoice(const SoundPlaybackParams &params);
+    std::optional<size_t> acquireSample(Rank newRank, bool winTies);
+    bool startSample(size_t index, size_t sample);
+    void virtualize(size_t index);
+    void promoteVoices();
+    void releaseVoice(size_t index);
+    void releaseStoppedVoices();
+    [[nodiscard]] Rank rank(const SoundPlaybackParams &params) const;
+    [[nodiscard]] bool isAudible(const Voice &voice, float maxDistance) const;
+    [[nodiscard]] size_t realVoiceCount() const;
+    void updateVoiceCounts();
+
  private:
-    std::list<AudioSamplePoolEntry> _samplePool;
-    bool _looping;
+    bool _looping = false;
+    size_t _requestedCapacity = 0;
+    SampleFactory _factory;
+    std::vector<PAudioSample> _samples;
+    std::vector<size_t> _freeSamples;
+    std::vector<Voice> _voices;
+    std::vector<size_t> _freeVoices;
+    std::vector<size_t> _activeVoices;
+    std::unordered_map<SoundId, size_t> _voiceBySoundId;
+    std::unordered_map<uint16_t, size_t> _voiceByPid; // Keyed by packed pid.
+    uint64_t _nextSerial = 0;
+    Vec3f _listenerPosition;
+    AudioSamplePoolStats _stats; // Stats for the current frame.
+    AudioSamplePoolStats _frameStats; // Stats for the last frame.
 };
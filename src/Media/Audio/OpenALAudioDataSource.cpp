@@ -6,8 +6,14 @@
 
 #include "OpenALSoundProvider.h"
 
+OpenALAudioDataSource::OpenALAudioDataSource(PAudioDataSource baseDataSource) : _baseDataSource(baseDataSource) {
+    // Base data source is released in Open, so these are saved upfront.
+    updateFormat();
+}
+
 OpenALAudioDataSource::~OpenALAudioDataSource() {
-    _baseDataSource->Close();
+    if (_baseDataSource)
+        _baseDataSource->Close();
     if (_buffers.size()) {
         alDeleteBuffers(_buffers.size(), &_buffers.front());
     }
@@ -19,6 +25,7 @@ bool OpenALAudioDataSource::Open() {
     }
 
     _baseDataSource->Open();
+    updateFormat(); // Some data sources only know the format once opened.
 
     bool result = true;
     ALsizei al_sample_rate = GetSampleRate();
@@ -76,11 +83,16 @@ bool OpenALAudioDataSource::Open() {
 
     _baseDataSource->Close();
 
+    // The data now lives in the OpenAL buffers, no need to keep our copy around.
+    if (result && _buffers.size())
+        _baseDataSource.reset();
+
     return result;
 }
 
 void OpenALAudioDataSource::Close() {
-    _baseDataSource->Close();
+    if (_baseDataSource)
+        _baseDataSource->Close();
 }
 
 bool OpenALAudioDataSource::linkSource(ALuint al_source) {
@@ -91,6 +103,12 @@ bool OpenALAudioDataSource::linkSource(ALuint al_source) {
     return true;
 }
 
+void OpenALAudioDataSource::updateFormat() {
+    _sampleRate = _baseDataSource->GetSampleRate();
+    _channelCount = _baseDataSource->GetChannelCount();
+    _duration = _baseDataSource->GetDuration();
+}
+
 PAudioDataSource PlatformDataSourceInitialize(PAudioDataSource baseDataSource) {
     return std::make_shared<OpenALAudioDataSource>(baseDataSource);
 }
@@ -9,24 +9,33 @@
 
 // TODO(Nik-RE-dev): this middleware class is temporary because Media API is not fully
 // ready to properly support current use cases
+//
+// Once the data is uploaded into OpenAL buffers in `Open`, the base data source is released, so that the sound
+// data is not kept in memory twice. `GetNextBuffer` returns nothing after that.
 class OpenALAudioDataSource : public IAudioDataSource {
  public:
-    explicit OpenALAudioDataSource(PAudioDataSource baseDataSource):_baseDataSource(baseDataSource) {}
+    explicit OpenALAudioDataSource(PAudioDataSource baseDataSource);
     virtual ~OpenALAudioDataSource() override;
 
     virtual bool Open() override;
     virtual void Close() override;
 
-    virtual size_t GetSampleRate() override { return _baseDataSource->GetSampleRate(); }
-    virtual size_t GetChannelCount() override { return _baseDataSource->GetChannelCount(); }
-    virtual Blob GetNextBuffer() override { return _baseDataSource->GetNextBuffer(); }
+    virtual size_t GetSampleRate() override { return _sampleRate; }
+    virtual size_t GetChannelCount() override { return _channelCount; }
+    virtual Blob GetNextBuffer() override { return _baseDataSource ? _baseDataSource->GetNextBuffer() : Blob(); }
 
-    virtual float GetDuration() override { return _baseDataSource->GetDuration(); }
+    virtual float GetDuration() override { return _duration; }
 
     bool linkSource(ALuint al_source);
 
+ protected:
+    void updateFormat();
+
  protected:
     PAudioDataSource _baseDataSource;
+    size_t _sampleRate = 0;
+    size_t _channelCount = 0;
+    float _duration = 0;
     std::vector<ALuint> _buffers;
 };
 
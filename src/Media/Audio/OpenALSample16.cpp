@@ -5,12 +5,24 @@
 #include "OpenALSoundProvider.h"
 #include "OpenALAudioDataSource.h"
 
+AudioSample16::AudioSample16() {
+    alGenSources(1, &al_source);
+
+    // For some obscure reason we sometimes get al_source == -1 even though checkOpenALError() returns false. So we check it too.
+    if (checkOpenALError() || al_source == -1) {
+        al_source = -1;
+        return;
+    }
+
+    defaultSource();
+}
+
 AudioSample16::~AudioSample16() { Close(); }
 
 void AudioSample16::Close() {
     pDataSource = nullptr;
 
-    if (alIsSource(al_source) != 0) {
+    if (al_source != -1 && alIsSource(al_source) != 0) {
         alSourceStop(al_source);
         checkOpenALError();
         alSourcei(al_source, AL_BUFFER, 0);
@@ -31,6 +43,8 @@ void AudioSample16::defaultSource() {
 }
 
 bool AudioSample16::Open(PAudioDataSource data_source) {
+    Unload();
+
     pDataSource = data_source;
     if (!pDataSource) {
         return false;
@@ -38,27 +52,31 @@ bool AudioSample16::Open(PAudioDataSource data_source) {
 
     std::shared_ptr<OpenALAudioDataSource> openalDataSource = std::dynamic_pointer_cast<OpenALAudioDataSource, IAudioDataSource>(pDataSource);
 
-    if (!openalDataSource->Open()) {
-        return false;
-    }
-
-    alGenSources(1, &al_source);
-
-    // For some obscure reason we sometimes get al_source == -1 even though checkOpenALError() returns false. So we check it too.
-    if (checkOpenALError() || al_source == -1) {
+    if (!IsValid() || !openalDataSource->Open()) {
         return false;
     }
 
     defaultSource();
 
     if (!openalDataSource->linkSource(al_source)) {
-        Close();
+        Unload();
         return false;
     }
 
     return true;
 }
 
+void AudioSample16::Unload() {
+    if (IsValid()) {
+        alSourceStop(al_source);
+        checkOpenALError();
+        alSourcei(al_source, AL_BUFFER, 0); // Detach buffers so that they can be deleted with the data source.
+        checkOpenALError();
+    }
+
+    pDataSource = nullptr;
+}
+
 bool AudioSample16::SetPosition(float x, float y, float z, float max_dist) {
     _position = Vec3f(x, y, z);
     _maxDistance = max_dist;
@@ -180,6 +198,23 @@ bool AudioSample16::SetVolume(float volume) {
     return true;
 }
 
+bool AudioSample16::Seek(float seconds) {
+    if (!IsValid()) {
+        return false;
+    }
+
+    // If the source is not playing yet, the offset is applied once it starts.
+    alSourcef(al_source, AL_SEC_OFFSET, seconds);
+    if (checkOpenALError()) {
+        return false;
+    }
+
+    return true;
+}
+
 PAudioSample CreateAudioSample() {
-    return std::make_shared<AudioSample16>();
+    std::shared_ptr<AudioSample16> result = std::make_shared<AudioSample16>();
+    if (!result->IsValid())
+        return nullptr;
+    return result;
 }
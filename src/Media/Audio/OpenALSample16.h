@@ -9,10 +9,15 @@
 
 class AudioSample16 : public IAudioSample {
  public:
-    AudioSample16() {}
+    /**
+     * Creates an OpenAL source for this sample, the source is then reused for all the sounds played through it. Use
+     * `IsValid` to check whether the source was created successfully.
+     */
+    AudioSample16();
     virtual ~AudioSample16() override;
 
     virtual bool Open(PAudioDataSource data_source) override;
+    virtual void Unload() override;
     virtual bool IsValid() override;
     virtual bool IsStopped() override;
 
@@ -22,6 +27,7 @@ class AudioSample16 : public IAudioSample {
     virtual bool Resume() override;
     virtual bool SetVolume(float volume) override;
     virtual bool SetPosition(float x, float y, float z, float max_dist) override;
+    virtual bool Seek(float seconds) override;
 
  protected:
     void Close();
@@ -34,4 +40,7 @@ class AudioSample16 : public IAudioSample {
     float _volume = 0.0;
 };
 
+/**
+ * @return                              New OpenAL sample, or `nullptr` if OpenAL is out of sources.
+ */
 PAudioSample CreateAudioSample();
@@ -135,6 +135,14 @@ void OpenALSoundProvider::DeleteBuffers(StreamingTrackBuffer *track, int type) {
             logger->warning("OpenAL: Fail to unqueue buffers.");
             assert(false);
         } else {
+            if (type == AL_BUFFERS_PROCESSED) {
+                for (int i = 0; i < count; i++) {
+                    int size = 0;
+                    alGetBufferi(buffer_ids[i], AL_SIZE, &size);
+                    track->processed_bytes += size;
+                }
+            }
+
             alDeleteBuffers(count, buffer_ids);
             if (checkOpenALError()) {
                 logger->warning("OpenAL: Fail to delete buffers.");
@@ -216,9 +224,32 @@ OpenALSoundProvider::CreateStreamingTrack16(int num_channels, int sample_rate,
     ret->source_id = al_source;
     ret->sample_format = sound_format;
     ret->sample_rate = sample_rate;
+    ret->num_channels = num_channels;
     return ret;
 }
 
+std::optional<double> OpenALSoundProvider::StreamingTime(StreamingTrackBuffer *buffer) {
+    if (buffer == nullptr) {
+        return std::nullopt;
+    }
+
+    int status = 0;
+    alGetSourcei(buffer->source_id, AL_SOURCE_STATE, &status);
+    if (status != AL_PLAYING) {
+        return std::nullopt;
+    }
+
+    // Sample offset is relative to the first buffer that's still in the queue.
+    int offset = 0;
+    alGetSourcei(buffer->source_id, AL_SAMPLE_OFFSET, &offset);
+    if (checkOpenALError()) {
+        return std::nullopt;
+    }
+
+    int64_t processed_samples = buffer->processed_bytes / (buffer->num_channels * 2);
+    return static_cast<double>(processed_samples + offset) / buffer->sample_rate;
+}
+
 void OpenALSoundProvider::Stream16(StreamingTrackBuffer *buffer,
                                    int num_samples, const void *samples,
                                    bool wait) {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 
 #include <al.h> // NOLINT: not a C system header.
 #include <alc.h> // NOLINT: not a C system header.
@@ -10,12 +12,18 @@ constexpr float MAX_SOUND_DIST = 60000.0f;
 constexpr float REFERENCE_DIST = 300.0f;
 constexpr float ROLLOFF_FACTOR = 1.5f;
 
+// Distance at which the gain drops to ~1%, positional sounds that are farther away than this are not played through
+// OpenAL. For the inverse distance model it's REFERENCE_DIST * (1 + 99 / ROLLOFF_FACTOR).
+constexpr float VIRTUAL_SOUND_DIST = 20000.0f;
+
 class OpenALSoundProvider {
  public:
     struct StreamingTrackBuffer {
         unsigned int source_id;
         ALenum sample_format;
         int sample_rate;
+        int num_channels;
+        int64_t processed_bytes = 0; // Size of the buffers that were played & unqueued.
     };
 
     OpenALSoundProvider();
@@ -30,6 +38,13 @@ class OpenALSoundProvider {
                                                  int bytes_per_sample);
     void Stream16(StreamingTrackBuffer *buffer, int num_samples,
                   const void *samples, bool wait = false);
+
+    /**
+     * @param buffer                    Streaming track.
+     * @return                          Time in seconds since the start of the track, as heard by the user, or
+     *                                  `std::nullopt` if the track is not playing, e.g. because it ran out of data.
+     */
+    std::optional<double> StreamingTime(StreamingTrackBuffer *buffer);
     void SetListenerPosition(float x, float y, float z);
     void SetOrientation(float yaw, float pitch);
 
@@ -0,0 +1,83 @@
+#include "SoundCache.h"
+
+#include <cassert>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "OpenALAudioDataSource.h"
+
+SoundCache::SoundCache() = default;
+
+SoundCache::~SoundCache() = default;
+
+void SoundCache::setBudget(size_t budget) {
+    _budget = budget;
+}
+
+PAudioDataSource SoundCache::find(SoundId id) {
+    auto pos = _entries.find(id);
+    if (pos == _entries.end())
+        return nullptr;
+
+    pos->second.lastUse = ++_clock;
+    return pos->second.dataSource;
+}
+
+PAudioDataSource SoundCache::insert(SoundId id, DecodedAudio audio) {
+    assert(!_entries.contains(id));
+    assert(audio.channelCount > 0);
+
+    size_t bytes = audio.pcm.size();
+    if (_budget != 0 && _stats.bytes + bytes > _budget) {
+        size_t target = _budget - _budget / 8;
+        evictUntil(target > bytes ? target - bytes : 0);
+    }
+
+    Entry &entry = _entries[id];
+    entry.bytes = bytes;
+    entry.lastUse = ++_clock;
+    entry.dataSource = PlatformDataSourceInitialize(std::make_shared<AudioPcmDataSource>(std::move(audio)));
+
+    _stats.sounds = _entries.size();
+    _stats.bytes += bytes;
+    _stats.peakBytes = std::max(_stats.peakBytes, _stats.bytes);
+    return entry.dataSource;
+}
+
+void SoundCache::trim() {
+    if (_budget == 0 || _stats.bytes <= _budget)
+        return;
+
+    // Evict a bit more than needed so that we don't end up doing this on every insert.
+    evictUntil(_budget - _budget / 8);
+}
+
+void SoundCache::evict(SoundId id) {
+    auto pos = _entries.find(id);
+    assert(pos != _entries.end() && pos->second.dataSource.use_count() == 1);
+
+    _stats.bytes -= pos->second.bytes;
+    _entries.erase(pos); // Releases the OpenAL buffer, or our copy of the data if the sound was never played.
+
+    _stats.sounds = _entries.size();
+    _stats.evictions++;
+}
+
+void SoundCache::evictUntil(size_t bytes) {
+    if (_stats.bytes <= bytes)
+        return;
+
+    std::vector<std::pair<uint64_t, SoundId>> candidates;
+    for (const auto &[id, entry] : _entries)
+        if (entry.dataSource.use_count() == 1) // Not playing.
+            candidates.emplace_back(entry.lastUse, id);
+    std::ranges::sort(candidates);
+
+    for (const auto &[_, id] : candidates) {
+        if (_stats.bytes <= bytes)
+            break;
+        evict(id);
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+
+#include "Media/AudioDataSource.h"
+#include "Media/AudioPcmDataSource.h"
+
+#include "SoundEnums.h"
+
+/**
+ * Profiling counters for `SoundCache`.
+ */
+struct SoundCacheStats {
+    size_t hits = 0; // Playback requests that were served from the cache.
+    size_t misses = 0; // Playback requests that had to decode the sound, including reloads of evicted sounds.
+    size_t evictions = 0; // Number of times a sound was evicted.
+    size_t sounds = 0; // Number of sounds currently in the cache.
+    size_t bytes = 0; // Memory currently used by the decoded data of the cached sounds.
+    size_t peakBytes = 0; // Max value of `bytes` so far.
+};
+
+/**
+ * Memory-budgeted LRU cache of decoded sounds, keyed by `SoundId`.
+ *
+ * Decoded signed 16-bit PCM data is handed over to the data source as is, without copying. When the sound is first
+ * played, the data is uploaded into an OpenAL buffer, and our copy is released. Thus at any point there is only one
+ * copy of the decoded data - either ours, or OpenAL's, and this is what's counted against the budget.
+ *
+ * Sounds that are currently playing are never evicted. A sound is considered playing if anyone other than the cache
+ * holds a reference to its data source - audio samples do that for as long as they are alive. Evicted sounds are
+ * expected to be decoded again on next use.
+ *
+ * This class is not thread-safe, all calls must come from the main thread.
+ */
+class SoundCache {
+ public:
+    SoundCache();
+    ~SoundCache();
+
+    SoundCache(const SoundCache &) = delete;
+    SoundCache &operator=(const SoundCache &) = delete;
+
+    /**
+     * @param budget                    Memory budget in bytes, zero means unlimited. Takes effect on the next call to
+     *                                  `insert` or `trim`.
+     */
+    void setBudget(size_t budget);
+
+    [[nodiscard]] size_t budget() const {
+        return _budget;
+    }
+
+    /**
+     * @param id                        Sound to look up.
+     * @return                          Data source for the cached sound, or `nullptr` if the sound is not in the
+     *                                  cache. Found sounds are marked as most recently used. Hits & misses are not
+     *                                  recorded, use `recordHit` & `recordMiss` for that.
+     */
+    [[nodiscard]] PAudioDataSource find(SoundId id);
+
+    /**
+     * @param id                        Sound to check.
+     * @return                          Whether the provided sound is in the cache. Doesn't affect the LRU order.
+     */
+    [[nodiscard]] bool contains(SoundId id) const {
+        return _entries.contains(id);
+    }
+
+    /**
+     * Moves the provided decoded sound into the cache, evicting least recently used idle sounds if needed to stay
+     * within the budget. If all cached sounds are playing, then the budget is exceeded.
+     *
+     * @param id                        Sound id, must not be in the cache.
+     * @param audio                     Decoded sound.
+     * @return                          Data source for the cached sound.
+     */
+    PAudioDataSource insert(SoundId id, DecodedAudio audio);
+
+    /**
+     * Evicts least recently used idle sounds until the cache is within the budget. Meant to be called once per frame,
+     * so that sounds that were playing when the cache went over budget are eventually evicted.
+     */
+    void trim();
+
+    void recordHit() {
+        _stats.hits++;
+    }
+
+    void recordMiss() {
+        _stats.misses++;
+    }
+
+    [[nodiscard]] const SoundCacheStats &stats() const {
+        return _stats;
+    }
+
+ private:
+    struct Entry {
+        PAudioDataSource dataSource;
+        size_t bytes = 0;
+        uint64_t lastUse = 0;
+    };
+
+    void evict(SoundId id);
+    void evictUntil(size_t bytes);
+
+ private:
+    std::unordered_map<SoundId, Entry> _entries;
+    uint64_t _clock = 0;
+    size_t _budget = 0;
+    SoundCacheStats _stats;
+};
@@ -231,6 +231,24 @@ enum class SoundPlaybackResult {
     SOUND_PLAYBACK_INVALID,
     SOUND_PLAYBACK_FAILED,
     SOUND_PLAYBACK_SKIPPED,
-    SOUND_PLAYBACK_SUCCEEDED
+    SOUND_PLAYBACK_SUCCEEDED,
+
+    /** All voices were busy playing more important sounds, so the sound wasn't started. */
+    SOUND_PLAYBACK_DROPPED
 };
 using enum SoundPlaybackResult;
+
+/**
+ * Sound priority, used to decide which sound to stop when running out of voices.
+ */
+enum class SoundPriority {
+    /** Looping ambient sounds, e.g. decoration sounds. */
+    SOUND_PRIORITY_AMBIENT,
+
+    /** Positional sounds in the game world - monsters, doors, projectiles. */
+    SOUND_PRIORITY_WORLD,
+
+    /** Sounds that the player should always hear - UI sounds, speech, character voices. */
+    SOUND_PRIORITY_INTERFACE,
+};
+using enum SoundPriority;
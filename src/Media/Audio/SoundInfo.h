@@ -18,5 +18,4 @@ class SoundInfo {
     SoundType eType;
     SoundId uSoundID;
     SoundFlags uFlags;
-    PAudioDataSource dataSource;
 };
@@ -0,0 +1,323 @@
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Logger/BufferLogSink.h"
+#include "Library/Logger/Logger.h"
+
+#include "Media/Audio/AudioSamplePool.h"
+
+namespace {
+class StubDataSource : public IAudioDataSource {
+ public:
+    virtual bool Open() override { return true; }
+    virtual void Close() override {}
+    virtual size_t GetSampleRate() override { return 22050; }
+    virtual size_t GetChannelCount() override { return 1; }
+    virtual Blob GetNextBuffer() override { return Blob(); }
+    virtual float GetDuration() override { return 1.0f; }
+};
+
+class StubSample : public IAudioSample {
+ public:
+    virtual bool Open(PAudioDataSource data_source) override {
+        _source = data_source;
+        return _source != nullptr;
+    }
+    virtual void Unload() override {
+        _source = nullptr;
+        _stopped = true;
+    }
+    virtual bool IsValid() override { return _source != nullptr; }
+    virtual bool IsStopped() override { return _stopped; }
+    virtual bool Play(bool loop, bool positioned) override {
+        _stopped = false;
+        return true;
+    }
+    virtual bool Stop() override {
+        _stopped = true;
+        return true;
+    }
+    virtual bool Pause() override { return true; }
+    virtual bool Resume() override { return true; }
+    virtual bool SetVolume(float volume) override { return true; }
+    virtual bool SetPosition(float x, float y, float z, float max_dist) override { return true; }
+    virtual bool Seek(float seconds) override {
+        _offset = seconds;
+        return true;
+    }
+
+    void finish() {
+        _stopped = true;
+    }
+
+    float offset() const {
+        return _offset;
+    }
+
+ private:
+    PAudioDataSource _source;
+    bool _stopped = true;
+    float _offset = 0;
+};
+
+using StubSampleList = std::vector<std::shared_ptr<StubSample>>;
+
+/**
+ * Sample pool that uses stub voices, so that it can be tested without an audio device.
+ */
+class TestPool : public AudioSamplePool {
+ public:
+    /**
+     * @param capacity                  Requested pool capacity.
+     * @param maxSamples                Max number of stub voices that the factory can create, emulating a platform
+     *                                  that's running out of voices.
+     */
+    explicit TestPool(size_t capacity, size_t maxSamples = SIZE_MAX) :
+        TestPool(capacity, maxSamples, std::make_shared<StubSampleList>()) {}
+
+    void finishAll() {
+        for (const std::shared_ptr<StubSample> &sample : *_samples)
+            sample->finish();
+    }
+
+    const StubSampleList &samples() const {
+        return *_samples;
+    }
+
+ private:
+    TestPool(size_t capacity, size_t maxSamples, std::shared_ptr<StubSampleList> samples) :
+        AudioSamplePool(false, capacity, [samples, maxSamples] () -> PAudioSample {
+            if (samples->size() >= maxSamples)
+                return nullptr;
+            samples->push_back(std::make_shared<StubSample>());
+            return samples->back();
+        }), _samples(samples) {
+        initialize();
+    }
+
+ private:
+    std::shared_ptr<StubSampleList> _samples;
+};
+
+SoundPlaybackParams worldParams(float x) {
+    SoundPlaybackParams result;
+    result.priority = SOUND_PRIORITY_WORLD;
+    result.positional = true;
+    result.position = Vec3f(x, 0, 0);
+    return result;
+}
+} // namespace
+
+static PAudioDataSource source() {
+    return std::make_shared<StubDataSource>();
+}
+
+UNIT_TEST(AudioSamplePool, Unique) {
+    TestPool pool(4);
+    SoundId id = static_cast<SoundId>(100);
+    Pid pid(OBJECT_Actor, 1);
+
+    EXPECT_EQ(pool.playUniqueSoundId(source(), id, {}), SOUND_PLAYBACK_SUCCEEDED);
+    EXPECT_EQ(pool.playUniqueSoundId(source(), id, {}), SOUND_PLAYBACK_SKIPPED);
+    EXPECT_EQ(pool.playUniquePid(source(), pid, {}), SOUND_PLAYBACK_SUCCEEDED);
+    EXPECT_EQ(pool.playUniquePid(source(), pid, {}), SOUND_PLAYBACK_SKIPPED);
+    EXPECT_TRUE(pool.hasPlaying());
+    EXPECT_TRUE(pool.hasSoundId(id));
+    EXPECT_TRUE(pool.hasPid(pid));
+    EXPECT_FALSE(pool.hasSoundId(static_cast<SoundId>(101)));
+    EXPECT_FALSE(pool.hasPid(Pid(OBJECT_Actor, 2)));
+
+    pool.stopSoundId(id);
+    EXPECT_FALSE(pool.hasSoundId(id));
+    EXPECT_EQ(pool.playUniqueSoundId(source(), id, {}), SOUND_PLAYBACK_SUCCEEDED);
+    pool.stopPid(pid);
+    EXPECT_EQ(pool.playUniquePid(source(), pid, {}), SOUND_PLAYBACK_SUCCEEDED);
+
+    pool.finishAll();
+    EXPECT_FALSE(pool.hasSoundId(id)); // Finished sounds don't count.
+    EXPECT_FALSE(pool.hasPid(pid));
+
+    pool.stop();
+    EXPECT_FALSE(pool.hasPlaying());
+}
+
+UNIT_TEST(AudioSamplePool, FinishedVoicesAreReused) {
+    TestPool pool(2);
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(pool.playNew(source(), {}), SOUND_PLAYBACK_SUCCEEDED);
+        EXPECT_EQ(pool.playNew(source(), {}), SOUND_PLAYBACK_SUCCEEDED);
+        pool.finishAll();
+    }
+    pool.update();
+    EXPECT_EQ(pool.frameStats().started, 20);
+    EXPECT_EQ(pool.frameStats().stolen, 0);
+    EXPECT_EQ(pool.frameStats().peakVoices, 2);
+    EXPECT_EQ(pool.frameStats().voices, 0);
+}
+
+UNIT_TEST(AudioSamplePool, Stealing) {
+    TestPool pool(2);
+    pool.setListenerPosition(Vec3f(0, 0, 0));
+
+    EXPECT_EQ(pool.playUniquePid(source(), Pid(OBJECT_Actor, 1), worldParams(100)), SOUND_PLAYBACK_SUCCEEDED);
+    EXPECT_EQ(pool.playUniquePid(source(), Pid(OBJECT_Actor, 2), worldParams(1000)), SOUND_PLAYBACK_SUCCEEDED);
+
+    // Farther than everything that's playing - starts virtual.
+    EXPECT_EQ(pool.playUniquePid(source(), Pid(OBJECT_Actor, 3), worldParams(5000)), SOUND_PLAYBACK_SUCCEEDED);
+
+    // Closer - steals the farthest voice, which goes virtual & is still tracked.
+    EXPECT_EQ(pool.playUniquePid(source(), Pid(OBJECT_Actor, 4), worldParams(500)), SOUND_PLAYBACK_SUCCEEDED);
+    EXPECT_EQ(pool.playUniquePid(source(), Pid(OBJECT_Actor, 2), worldParams(1000)), SOUND_PLAYBACK_SKIPPED);
+    EXPECT_EQ(pool.playUniquePid(source(), Pid(OBJECT_Actor, 1), worldParams(100)), SOUND_PLAYBACK_SKIPPED);
+
+    // Interface sounds always win over the world sounds.
+    EXPECT_EQ(pool.playNew(source(), {}), SOUND_PLAYBACK_SUCCEEDED);
+
+    // Virtual voices are not promoted by stealing from equally or more important voices.
+    pool.update();
+    EXPECT_EQ(pool.frameStats().started, 5);
+    EXPECT_EQ(pool.frameStats().stolen, 2);
+    EXPECT_EQ(pool.frameStats().promoted, 0);
+    EXPECT_EQ(pool.frameStats().dropped, 0);
+    EXPECT_EQ(pool.frameStats().voices, 2);
+    EXPECT_EQ(pool.frameStats().virtualVoices, 3);
+
+    // Once a voice is freed, the most important virtual voice takes it.
+    pool.stopPid(Pid(OBJECT_Actor, 1));
+    pool.update();
+    EXPECT_EQ(pool.frameStats().promoted, 1);
+    EXPECT_EQ(pool.frameStats().voices, 2);
+    EXPECT_EQ(pool.frameStats().virtualVoices, 2);
+    EXPECT_EQ(pool.playUniquePid(source(), Pid(OBJECT_Actor, 4), worldParams(500)), SOUND_PLAYBACK_SKIPPED);
+}
+
+UNIT_TEST(AudioSamplePool, Dropping) {
+    TestPool pool(1);
+    pool.setListenerPosition(Vec3f(0, 0, 0));
+
+    // Fill up all logical voices.
+    EXPECT_EQ(pool.playNew(source(), {}), SOUND_PLAYBACK_SUCCEEDED);
+    for (size_t i = 1; i < AudioSamplePool::VIRTUAL_VOICE_RATIO; i++)
+        EXPECT_EQ(pool.playNew(source(), worldParams(1000 * i)), SOUND_PLAYBACK_SUCCEEDED);
+
+    // Closer than the farthest virtual voice - replaces it.
+    EXPECT_EQ(pool.playNew(source(), worldParams(500)), SOUND_PLAYBACK_SUCCEEDED);
+
+    // Farther than everything - dropped.
+    EXPECT_EQ(pool.playNew(source(), worldParams(50000)), SOUND_PLAYBACK_DROPPED);
+
+    pool.update();
+    EXPECT_EQ(pool.frameStats().dropped, 2);
+    EXPECT_EQ(pool.frameStats().voices, 1);
+    EXPECT_EQ(pool.frameStats().virtualVoices, AudioSamplePool::VIRTUAL_VOICE_RATIO - 1);
+}
+
+UNIT_TEST(AudioSamplePool, VirtualVoices) {
+    TestPool pool(2);
+    pool.setListenerPosition(Vec3f(0, 0, 0));
+
+    // Too far to be heard.
+    EXPECT_EQ(pool.playNew(source(), worldParams(30000)), SOUND_PLAYBACK_SUCCEEDED);
+    EXPECT_FALSE(pool.hasPlaying());
+    pool.update(0.25f);
+    EXPECT_EQ(pool.frameStats().voices, 0);
+    EXPECT_EQ(pool.frameStats().virtualVoices, 1);
+
+    // Listener walks up to the sound - it's promoted & continues from where it would have been.
+    pool.setListenerPosition(Vec3f(29000, 0, 0));
+    pool.update(0.25f);
+    EXPECT_EQ(pool.frameStats().promoted, 1);
+    EXPECT_EQ(pool.frameStats().voices, 1);
+    EXPECT_TRUE(pool.hasPlaying());
+    EXPECT_FLOAT_EQ(pool.samples()[0]->offset(), 0.5f);
+
+    // And walks away.
+    pool.setListenerPosition(Vec3f(0, 0, 0));
+    pool.update(0.25f);
+    EXPECT_EQ(pool.frameStats().demoted, 1);
+    EXPECT_EQ(pool.frameStats().virtualVoices, 1);
+    EXPECT_FALSE(pool.hasPlaying());
+
+    // Virtual voice finishes when the sound would have finished.
+    pool.update(0.5f);
+    EXPECT_EQ(pool.frameStats().voices, 0);
+    EXPECT_EQ(pool.frameStats().virtualVoices, 0);
+}
+
+UNIT_TEST(AudioSamplePool, OutOfPlatformVoices) {
+    BufferLogSink sink;
+    Logger testLogger(LOG_WARNING, &sink);
+
+    TestPool pool(4, 2);
+    EXPECT_EQ(pool.capacity(), 2);
+    EXPECT_EQ(pool.samples().size(), 2);
+
+    // Sounds that don't fit into the real voices that we have go virtual.
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(pool.playNew(source(), {}), SOUND_PLAYBACK_SUCCEEDED);
+    pool.update();
+    EXPECT_EQ(pool.frameStats().voices, 2);
+    EXPECT_EQ(pool.frameStats().virtualVoices, 2);
+}
+
+UNIT_TEST(AudioSamplePool, NoPlatformVoices) {
+    BufferLogSink sink;
+    Logger testLogger(LOG_WARNING, &sink);
+
+    TestPool pool(4, 0);
+    EXPECT_EQ(pool.capacity(), 0);
+    EXPECT_EQ(pool.playNew(source(), {}), SOUND_PLAYBACK_SUCCEEDED);
+    EXPECT_FALSE(pool.hasPlaying());
+}
+
+UNIT_TEST(AudioSamplePool, PositionTracking) {
+    TestPool pool(2);
+    pool.setListenerPosition(Vec3f(0, 0, 0));
+
+    Pid actor(OBJECT_Actor, 5);
+    Vec3f actorPosition(30000, 0, 0);
+    auto positionOf = [&](Pid pid) -> std::optional<Vec3f> {
+        if (pid == actor)
+            return actorPosition;
+        return std::nullopt;
+    };
+
+    SoundPlaybackParams params = worldParams(actorPosition.x);
+    params.owner = actor;
+    EXPECT_EQ(pool.playUniquePid(source(), actor, params), SOUND_PLAYBACK_SUCCEEDED);
+    pool.update(0.0f, positionOf);
+    EXPECT_EQ(pool.frameStats().virtualVoices, 1);
+
+    // Actor comes closer.
+    actorPosition = Vec3f(1000, 0, 0);
+    pool.update(0.0f, positionOf);
+    EXPECT_EQ(pool.frameStats().promoted, 1);
+    EXPECT_EQ(pool.frameStats().voices, 1);
+}
+
+UNIT_TEST(AudioSamplePool, Stress) {
+    // Simulates a busy map - lots of monsters making noises around the party, with some of the sounds finishing
+    // every frame.
+    TestPool pool(64);
+    pool.setListenerPosition(Vec3f(0, 0, 0));
+
+    size_t started = 0;
+    for (int frame = 0; frame < 1000; frame++) {
+        for (int i = 0; i < 50; i++) {
+            int actor = (frame * 50 + i) % 300;
+            Pid pid(OBJECT_Actor, actor);
+            EXPECT_NE(pool.playUniquePid(source(), pid, worldParams(actor * 10)), SOUND_PLAYBACK_FAILED);
+        }
+        if (frame % 3 == 0)
+            pool.finishAll();
+        pool.update();
+
+        EXPECT_LE(pool.frameStats().peakVoices, 64);
+        started += pool.frameStats().started;
+    }
+    EXPECT_GT(started, 0);
+}
@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Media/Audio/SoundCache.h"
+
+static DecodedAudio makeAudio(size_t size, size_t channelCount = 1) {
+    std::vector<char> pcm(size);
+    for (size_t i = 0; i < size; i++)
+        pcm[i] = static_cast<char>(i * 7);
+
+    DecodedAudio result;
+    result.pcm = Blob::copy(pcm.data(), pcm.size());
+    result.sampleRate = 22050;
+    result.channelCount = channelCount;
+    result.duration = 1.0f;
+    return result;
+}
+
+static SoundId soundId(int index) {
+    return static_cast<SoundId>(1000 + index);
+}
+
+UNIT_TEST(SoundCache, RoundTrip) {
+    SoundCache cache;
+    DecodedAudio audio = makeAudio(10000);
+    std::vector<char> expected(audio.pcm.string_view().begin(), audio.pcm.string_view().end());
+    const void *data = audio.pcm.data();
+
+    PAudioDataSource source = cache.insert(soundId(0), std::move(audio));
+    EXPECT_EQ(source->GetSampleRate(), 22050);
+    EXPECT_EQ(source->GetChannelCount(), 1);
+    EXPECT_EQ(source->GetDuration(), 1.0f);
+
+    Blob buffer = source->GetNextBuffer();
+    EXPECT_EQ(buffer.data(), data); // No copies.
+    EXPECT_EQ(buffer.size(), expected.size());
+    EXPECT_EQ(memcmp(buffer.data(), expected.data(), expected.size()), 0);
+    EXPECT_FALSE(source->GetNextBuffer());
+
+    EXPECT_EQ(cache.stats().sounds, 1);
+    EXPECT_EQ(cache.stats().bytes, 10000);
+    EXPECT_EQ(cache.find(soundId(0)), source);
+    EXPECT_EQ(cache.find(soundId(1)), nullptr);
+}
+
+UNIT_TEST(SoundCache, LruEviction) {
+    SoundCache cache;
+    cache.setBudget(300);
+
+    for (int i = 0; i < 3; i++)
+        (void) cache.insert(soundId(i), makeAudio(100));
+    (void) cache.find(soundId(0)); // Sound #1 is now the least recently used one.
+
+    (void) cache.insert(soundId(3), makeAudio(100));
+    EXPECT_TRUE(cache.contains(soundId(0)));
+    EXPECT_FALSE(cache.contains(soundId(1)));
+    EXPECT_TRUE(cache.contains(soundId(3)));
+    EXPECT_LE(cache.stats().bytes, cache.budget());
+    EXPECT_GE(cache.stats().evictions, 1);
+}
+
+UNIT_TEST(SoundCache, PlayingSoundsAreKept) {
+    SoundCache cache;
+    cache.setBudget(100);
+
+    PAudioDataSource playing = cache.insert(soundId(0), makeAudio(100));
+    (void) cache.insert(soundId(1), makeAudio(100));
+    EXPECT_TRUE(cache.contains(soundId(0)));
+    EXPECT_TRUE(cache.contains(soundId(1)));
+    EXPECT_EQ(cache.stats().bytes, 200); // Over budget.
+
+    playing.reset();
+    cache.trim();
+    EXPECT_FALSE(cache.contains(soundId(0)));
+    EXPECT_FALSE(cache.contains(soundId(1)));
+    EXPECT_EQ(cache.stats().bytes, 0);
+}
+
+UNIT_TEST(SoundCache, StaysWithinBudget) {
+    SoundCache cache;
+    cache.setBudget(64 * 1024);
+
+    for (int i = 0; i < 100; i++)
+        (void) cache.insert(soundId(i), makeAudio(16 * 1024));
+    EXPECT_LE(cache.stats().peakBytes, cache.budget());
+    EXPECT_EQ(cache.stats().evictions, 100 - cache.stats().sounds);
+}
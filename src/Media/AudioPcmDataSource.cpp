@@ -0,0 +1,79 @@
+#include "AudioPcmDataSource.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Utility/Memory/FreeDeleter.h"
+
+#include "AudioBufferDataSource.h"
+
+std::optional<DecodedAudio> decodeAudio(Blob buffer) {
+    AudioBufferDataSource source(std::move(buffer));
+    if (!source.Open())
+        return std::nullopt;
+
+    DecodedAudio result;
+    result.sampleRate = source.GetSampleRate();
+    result.channelCount = source.GetChannelCount();
+    result.duration = source.GetDuration();
+
+    std::vector<Blob> buffers;
+    size_t size = 0;
+    while (Blob chunk = source.GetNextBuffer()) {
+        size += chunk.size();
+        buffers.push_back(std::move(chunk));
+    }
+    source.Close();
+
+    if (size == 0)
+        return std::nullopt;
+
+    if (buffers.size() == 1) {
+        result.pcm = std::move(buffers[0]);
+    } else {
+        std::unique_ptr<void, FreeDeleter> pcm(malloc(size));
+        char *pos = static_cast<char *>(pcm.get());
+        for (const Blob &chunk : buffers) {
+            memcpy(pos, chunk.data(), chunk.size());
+            pos += chunk.size();
+        }
+        result.pcm = Blob::fromMalloc(std::move(pcm), size);
+    }
+    return result;
+}
+
+AudioPcmDataSource::AudioPcmDataSource(DecodedAudio audio) : _audio(std::move(audio)) {}
+
+bool AudioPcmDataSource::Open() {
+    _consumed = false;
+    return true;
+}
+
+void AudioPcmDataSource::Close() {}
+
+size_t AudioPcmDataSource::GetSampleRate() {
+    return _audio.sampleRate;
+}
+
+size_t AudioPcmDataSource::GetChannelCount() {
+    return _audio.channelCount;
+}
+
+Blob AudioPcmDataSource::GetNextBuffer() {
+    if (_consumed)
+        return Blob();
+
+    _consumed = true;
+    return Blob::share(_audio.pcm);
+}
+
+float AudioPcmDataSource::GetDuration() {
+    return _audio.duration;
+}
+
+PAudioDataSource CreateAudioPcmDataSource(DecodedAudio audio) {
+    return std::make_shared<AudioPcmDataSource>(std::move(audio));
+}
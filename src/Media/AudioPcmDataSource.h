@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "Utility/Memory/Blob.h"
+
+#include "AudioDataSource.h"
+
+/**
+ * Fully decoded sound.
+ */
+struct DecodedAudio {
+    Blob pcm; // Interleaved signed 16-bit samples.
+    size_t sampleRate = 0;
+    size_t channelCount = 0;
+    float duration = 0; // Duration in seconds, as reported by the container.
+};
+
+/**
+ * Decodes a sound file into PCM. Unlike the data sources, this function doesn't touch any shared state, and thus can
+ * be called from worker threads.
+ *
+ * @param buffer                        Encoded sound, in any format supported by FFmpeg.
+ * @return                              Decoded sound, or `std::nullopt` if the sound couldn't be decoded, or if it
+ *                                      doesn't have any samples.
+ */
+std::optional<DecodedAudio> decodeAudio(Blob buffer);
+
+/**
+ * Data source that serves already decoded PCM data as a single buffer.
+ */
+class AudioPcmDataSource : public IAudioDataSource {
+ public:
+    explicit AudioPcmDataSource(DecodedAudio audio);
+    virtual ~AudioPcmDataSource() = default;
+
+    virtual bool Open() override;
+    virtual void Close() override;
+
+    virtual size_t GetSampleRate() override;
+    virtual size_t GetChannelCount() override;
+    virtual Blob GetNextBuffer() override;
+
+    virtual float GetDuration() override;
+
+ protected:
+    DecodedAudio _audio;
+    bool _consumed = false;
+};
+
+PAudioDataSource CreateAudioPcmDataSource(DecodedAudio audio);
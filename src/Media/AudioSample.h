@@ -10,6 +10,12 @@ class IAudioSample {
     virtual ~IAudioSample() {}
 
     virtual bool Open(PAudioDataSource data_source) = 0;
+
+    /**
+     * Stops playback and releases the data source. Unlike destroying the sample, this keeps the underlying platform
+     * resources around, so that the sample can be cheaply reused with another call to `Open`.
+     */
+    virtual void Unload() = 0;
     virtual bool IsValid() = 0;
     virtual bool IsStopped() = 0;
 
@@ -19,5 +25,11 @@ class IAudioSample {
     virtual bool Resume() = 0;
     virtual bool SetVolume(float volume) = 0;
     virtual bool SetPosition(float x, float y, float z, float max_dist) = 0;
+
+    /**
+     * @param seconds                   Playback position to jump to. Should be called after `Open`, but before `Play`.
+     * @return                          Whether the position was changed successfully.
+     */
+    virtual bool Seek(float seconds) = 0;
 };
 typedef std::shared_ptr<IAudioSample> PAudioSample;
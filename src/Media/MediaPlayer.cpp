@@ -1,11 +1,15 @@
 #include "Media/MediaPlayer.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
 #include <vector>
 #include <thread>
@@ -298,16 +302,25 @@ static Recti calculateVideoRectangle(const IMovie &movie) {
     return rect;
 }
 
+/**
+ * Movie that can be played either through `GetFrame`, or through `PlayBink` / `renderFrame` for fullscreen bink
+ * videos.
+ *
+ * `GetFrame` playback is decoded ahead of time on a separate thread. The decoding thread streams the audio to OpenAL,
+ * and puts the decoded & converted video frames into a small ring buffer. The audio track is used as the clock, so
+ * `GetFrame` just picks the newest frame that's due, and never blocks on decoding except for the very first frame.
+ */
 class Movie : public IMovie {
  public:
+    /** Number of decoded video frames that are kept ready for display. */
+    static constexpr int64_t FRAME_RING_SIZE = 4;
+
     Movie() {
         width = 0;
         height = 0;
         format_ctx = nullptr;
         playback_time = 0.0;
 
-        last_resampled_frame_num = -1;
-
         audio_data_in_device = nullptr;
         format_ctx = nullptr;
 
@@ -316,6 +329,8 @@ class Movie : public IMovie {
     }
 
     virtual ~Movie() {
+        stopDecoding();
+
         if (_texture != nullptr) {
             _texture->release();
         }
@@ -395,71 +410,33 @@ class Movie : public IMovie {
             return Blob();
         }
 
-        auto current_time = std::chrono::system_clock::now();
-        auto diff = std::chrono::time_point_cast<std::chrono::milliseconds>(current_time) - std::chrono::time_point_cast<std::chrono::milliseconds>(start_time);
-
-        playback_time += std::chrono::duration_cast<std::chrono::milliseconds>(diff).count();
-        start_time = current_time;
-
-        int desired_frame_number = (int)((playback_time / video.frame_len) + 0.5);
-        if (last_resampled_frame_num == desired_frame_number) {
-            return Blob::share(video.last_frame);
-        }
-        last_resampled_frame_num++;
-        if (last_resampled_frame_num == video.stream->duration) {
-            if (looping) {
-                video.reset();
-                audio.reset();
-                int err = av_seek_frame(format_ctx, -1, 0,
-                                        AVSEEK_FLAG_BACKWARD | AVSEEK_FLAG_ANY);
-                char err_buf[2048];
-                av_strerror(err, err_buf, 2048);
-                if (err < 0) {
-                    Close();
-                    return Blob();
-                }
-                last_resampled_frame_num = 0;
-                playback_time = 0;
-                desired_frame_number = 0;
-            } else {
-                playing = false;
-                return Blob();
-            }
+        if (!_decodeThread.joinable()) {
+            _stopDecoding = false;
+            _decodeThread = std::thread([this] { decodeLoop(); });
         }
 
-        AVPacket *avpacket = av_packet_alloc();
+        double frameDuration = video.frame_len / 1000.0;
+        int64_t desiredFrame = static_cast<int64_t>(playbackTime() / frameDuration + 0.5);
 
-        // keep reading packets until we hit the end or find a video packet
-        do {
-            if (av_read_frame(format_ctx, avpacket) < 0) {
-                // probably movie is finished
-                playing = false;
-                av_packet_free(&avpacket);
-                return Blob();
-            }
+        std::unique_lock lock(_frameMutex);
+        // Only blocks until the first frame is decoded.
+        _frameDecoded.wait(lock, [&] { return _writeFrame > 0 || _decodingFinished; });
 
-            // Is this a packet from the video stream?
-            // audio packet - queue into playing
-            if (avpacket->stream_index == audio.stream_idx) {
-                Blob buffer = audio.decode_frame(avpacket);
-                if (buffer) {
-                    provider->Stream16(audio_data_in_device,
-                                       buffer.size() / 2,
-                                       buffer.data());
-                }
-            } else if (avpacket->stream_index == video.stream_idx) {
-              // Decode video frame
-              // video packet - decode & maybe show
-              video.decode_frame(avpacket);
-            } else {
-                assert(false);  // unknown stream
-            }
-        } while (avpacket->stream_index != video.stream_idx ||
-                 avpacket->pts <= desired_frame_number);
-
-        av_packet_free(&avpacket);
+        if (_decodingFinished && desiredFrame >= _writeFrame) {
+            playing = false;
+            return Blob();
+        }
 
-        return Blob::share(video.last_frame);
+        // Frames are numbered consecutively, so the newest frame that's due can be picked directly. If decoding falls
+        // behind, the newest decoded frame is shown until the next one is ready.
+        int64_t frame = std::clamp(desiredFrame, _readFrame, _writeFrame - 1);
+        Blob result = Blob::share(_frames[frame % FRAME_RING_SIZE]);
+        if (frame != _readFrame) {
+            _readFrame = frame;
+            lock.unlock();
+            _frameConsumed.notify_one();
+        }
+        return result;
     }
 
     virtual void PlayBink() override {
@@ -572,13 +549,27 @@ class Movie : public IMovie {
 
     virtual bool Play(bool loop = false) override {
         start_time = std::chrono::system_clock::now();
+
+        // Decoder state & the frame ring are kept across Stop / Play, so playback resumes from where it was stopped.
+        // The clock is only reset on the first start.
+        bool started = false;
+        {
+            std::lock_guard lock(_frameMutex);
+            started = _writeFrame > 0;
+        }
+        _clockBase = !started ? 0 : playing ? playbackTime() : _clockBase;
+        _clockStart = std::chrono::steady_clock::now();
         looping = loop;
         playing = true;
         return false;
     }
 
     virtual bool Stop() override {
+        if (playing) {
+            _clockBase = playbackTime(); // Freeze the clock, it's restarted in Play.
+        }
         playing = false;
+        stopDecoding();
         return false;
     }
 
@@ -682,6 +673,137 @@ class Movie : public IMovie {
     }
 
  protected:
+    /**
+     * @return                          Playback time in seconds. Follows the audio track while it's playing, and
+     *                                  falls back to the wall clock for movies without audio, and when the audio
+     *                                  is not playing, e.g. because it has already ended.
+     */
+    double playbackTime() {
+        auto now = std::chrono::steady_clock::now();
+
+        std::optional<double> audioTime;
+        {
+            std::lock_guard lock(_audioMutex);
+            audioTime = provider->StreamingTime(audio_data_in_device);
+        }
+        if (audioTime) {
+            _clockBase = *audioTime;
+            _clockStart = now;
+            return *audioTime;
+        }
+
+        return _clockBase + std::chrono::duration<double>(now - _clockStart).count();
+    }
+
+    /**
+     * Decoding thread's main loop. Keeps the ring buffer filled until the movie ends or decoding is stopped.
+     */
+    void decodeLoop() {
+        AVPacket *avpacket = av_packet_alloc();
+
+        while (true) {
+            {
+                std::unique_lock lock(_frameMutex);
+                _frameConsumed.wait(lock, [&] { return _stopDecoding || _writeFrame < _readFrame + FRAME_RING_SIZE; });
+                if (_stopDecoding) {
+                    break;
+                }
+            }
+
+            Blob frame = decodeNextFrame(avpacket);
+            bool finished = !frame;
+
+            {
+                std::lock_guard lock(_frameMutex);
+                if (finished) {
+                    _decodingFinished = true;
+                } else {
+                    _frames[_writeFrame % FRAME_RING_SIZE] = std::move(frame);
+                    _writeFrame++;
+                }
+            }
+            _frameDecoded.notify_one();
+
+            if (finished) {
+                break;
+            }
+        }
+
+        av_packet_free(&avpacket);
+    }
+
+    /**
+     * Reads packets until the next video frame is decoded, streaming the audio packets it comes across to OpenAL.
+     * Restarts from the beginning on end of file if the movie is looping.
+     *
+     * @param avpacket                  Packet to read into.
+     * @return                          Decoded video frame, or an empty blob if the movie has ended or on error.
+     */
+    Blob decodeNextFrame(AVPacket *avpacket) {
+        // Frames left over from the previous packet go first.
+        if (!video.queue.empty()) {
+            Blob result = std::move(video.queue.front());
+            video.queue.pop();
+            return result;
+        }
+
+        while (true) {
+            if (av_read_frame(format_ctx, avpacket) < 0) {
+                // Flush the frames that are still in the decoder.
+                if (Blob frame = video.decode_frame(nullptr)) {
+                    return frame;
+                }
+
+                if (!looping) {
+                    return Blob();
+                }
+
+                video.reset();
+                audio.reset();
+                if (av_seek_frame(format_ctx, -1, 0, AVSEEK_FLAG_BACKWARD | AVSEEK_FLAG_ANY) < 0) {
+                    logger->warning("ffmpeg: unable to rewind looping movie");
+                    return Blob();
+                }
+                continue;
+            }
+
+            Blob frame;
+            if (avpacket->stream_index == audio.stream_idx) {
+                // Stream everything that was decoded, otherwise the audio would lag behind & so would the video.
+                Blob buffer = audio.decode_frame(avpacket);
+                std::lock_guard lock(_audioMutex);
+                if (buffer) {
+                    provider->Stream16(audio_data_in_device, buffer.size() / 2, buffer.data());
+                }
+                while (!audio.queue.empty()) {
+                    const Blob &queued = audio.queue.front();
+                    provider->Stream16(audio_data_in_device, queued.size() / 2, queued.data());
+                    audio.queue.pop();
+                }
+            } else if (avpacket->stream_index == video.stream_idx) {
+                frame = video.decode_frame(avpacket);
+            }
+            av_packet_unref(avpacket);
+
+            if (frame) {
+                return frame;
+            }
+        }
+    }
+
+    void stopDecoding() {
+        if (!_decodeThread.joinable()) {
+            return;
+        }
+
+        {
+            std::lock_guard lock(_frameMutex);
+            _stopDecoding = true;
+        }
+        _frameConsumed.notify_one();
+        _decodeThread.join();
+    }
+
     void _renderTexture(const Blob &buffer) {
         // create texture from buffer
         if (_texture) {
@@ -704,7 +826,6 @@ class Movie : public IMovie {
     OpenALSoundProvider::StreamingTrackBuffer *audio_data_in_device;
 
     AVVideoStream video;
-    int last_resampled_frame_num;
 
     std::chrono::time_point<std::chrono::system_clock> start_time;
     bool looping;
@@ -722,6 +843,21 @@ class Movie : public IMovie {
     int _desiredFrameNumber;
     std::chrono::system_clock::time_point _currentTime;
     int _audioUpdateRate;
+
+    // Decode-ahead playback through GetFrame. Frame number N is stored in _frames[N % FRAME_RING_SIZE], frames in
+    // [_readFrame, _writeFrame) are decoded, and _readFrame is the one currently on screen.
+    std::thread _decodeThread;
+    std::mutex _frameMutex;
+    std::condition_variable _frameDecoded;
+    std::condition_variable _frameConsumed;
+    std::array<Blob, FRAME_RING_SIZE> _frames;
+    int64_t _readFrame = 0;
+    int64_t _writeFrame = 0;
+    bool _decodingFinished = false;
+    bool _stopDecoding = false;
+    std::mutex _audioMutex; // Guards the streaming audio track, which is fed from the decoding thread.
+    std::chrono::steady_clock::time_point _clockStart;
+    double _clockBase = 0; // Playback time at _clockStart, in seconds.
 };
 
 void MPlayer::Initialize() {
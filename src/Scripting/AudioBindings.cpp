@@ -9,6 +9,32 @@ sol::table AudioBindings::createBindingTable(sol::state_view &solState) const {
         }),
         "playMusic", sol::as_function([](MusicId musicId) {
             pAudioPlayer->MusicPlayTrack(musicId);
+        }),
+        "soundCacheStats", sol::as_function([](sol::this_state state) {
+            const SoundCacheStats &stats = pAudioPlayer->soundCacheStats();
+            return sol::state_view(state).create_table_with(
+                "hits", stats.hits,
+                "misses", stats.misses,
+                "evictions", stats.evictions,
+                "sounds", stats.sounds,
+                "bytes", stats.bytes,
+                "peakBytes", stats.peakBytes,
+                "budget", pAudioPlayer->soundCacheBudget()
+            );
+        }),
+        "voiceStats", sol::as_function([](sol::this_state state) {
+            AudioSamplePoolStats stats = pAudioPlayer->voicePoolStats();
+            return sol::state_view(state).create_table_with(
+                "voices", stats.voices,
+                "virtualVoices", stats.virtualVoices,
+                "peakVoices", stats.peakVoices,
+                "started", stats.started,
+                "stolen", stats.stolen,
+                "promoted", stats.promoted,
+                "demoted", stats.demoted,
+                "dropped", stats.dropped,
+                "capacity", pAudioPlayer->voicePoolCapacity()
+            );
         })
     );
 }
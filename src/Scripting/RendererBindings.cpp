@@ -1,11 +1,24 @@
 #include "RendererBindings.h"
 
 #include <Engine/Graphics/Renderer/Renderer.h>
+#include <Engine/Resources/AssetCache.h>
 
 sol::table RendererBindings::createBindingTable(sol::state_view &solState) const {
     return solState.create_table_with(
         "reloadShaders", sol::as_function([] {
             render->ReloadShaders();
+        }),
+        "assetCacheStats", sol::as_function([](sol::this_state state) {
+            const AssetCacheStats &stats = assetCache->stats();
+            return sol::state_view(state).create_table_with(
+                "hits", stats.hits,
+                "misses", stats.misses,
+                "evictions", stats.evictions,
+                "assets", stats.assets,
+                "bytes", stats.bytes,
+                "peakBytes", stats.peakBytes,
+                "budget", assetCache->budget()
+            );
         })
     );
 }
@@ -0,0 +1,106 @@
+#include "TaskGraph.h"
+
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "ThreadPool.h"
+
+struct TaskGraph::RunState {
+    TaskGraph *graph = nullptr;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<int> remainingDependencies;
+    std::vector<bool> poisoned; // Whether one of the task's dependencies has failed or was skipped.
+    int finishedCount = 0;
+    std::exception_ptr exception;
+
+    void complete(ThreadPool *pool, const std::shared_ptr<RunState> &self, TaskId id, bool failed);
+};
+
+TaskGraph::TaskId TaskGraph::add(std::string name, std::function<void()> task, std::initializer_list<TaskId> dependencies) {
+    TaskId id = _tasks.size();
+
+    Task &result = _tasks.emplace_back();
+    result.name = std::move(name);
+    result.function = std::move(task);
+    result.dependencyCount = dependencies.size();
+
+    for (TaskId dependency : dependencies) {
+        assert(dependency >= 0 && dependency < id);
+        _tasks[dependency].dependents.push_back(id);
+    }
+
+    return id;
+}
+
+void TaskGraph::run(ThreadPool *pool) {
+    assert(pool);
+
+    auto state = std::make_shared<RunState>();
+    state->graph = this;
+    state->poisoned.resize(_tasks.size());
+    for (Task &task : _tasks) {
+        state->remainingDependencies.push_back(task.dependencyCount);
+        task.duration = {};
+    }
+
+    for (TaskId id = 0; id < size(); id++)
+        if (_tasks[id].dependencyCount == 0)
+            schedule(pool, state, id);
+
+    std::unique_lock lock(state->mutex);
+    state->condition.wait(lock, [&] { return state->finishedCount == size(); });
+    if (state->exception)
+        std::rethrow_exception(state->exception);
+}
+
+void TaskGraph::schedule(ThreadPool *pool, const std::shared_ptr<RunState> &state, TaskId id) {
+    // The future is not needed, completion is tracked through the run state.
+    (void) pool->submit([pool, state, id] {
+        Task &task = state->graph->_tasks[id];
+
+        bool failed = false;
+        Clock::time_point start = Clock::now();
+        try {
+            task.function();
+        } catch (...) {
+            failed = true;
+            std::scoped_lock lock(state->mutex);
+            if (!state->exception)
+                state->exception = std::current_exception();
+        }
+        task.duration = Clock::now() - start;
+
+        state->complete(pool, state, id, failed);
+    });
+}
+
+void TaskGraph::RunState::complete(ThreadPool *pool, const std::shared_ptr<RunState> &self, TaskId id, bool failed) {
+    std::vector<std::pair<TaskId, bool>> ready; // (id, skip).
+    {
+        std::scoped_lock lock(mutex);
+        for (TaskId dependent : graph->_tasks[id].dependents) {
+            if (failed)
+                poisoned[dependent] = true;
+            if (--remainingDependencies[dependent] == 0)
+                ready.emplace_back(dependent, poisoned[dependent]);
+        }
+    }
+
+    // Skipped tasks are completed right away, so that their dependents get skipped too.
+    for (auto [dependent, skip] : ready) {
+        if (skip) {
+            complete(pool, self, dependent, true);
+        } else {
+            TaskGraph::schedule(pool, self, dependent);
+        }
+    }
+
+    std::scoped_lock lock(mutex);
+    finishedCount++;
+    condition.notify_all();
+}
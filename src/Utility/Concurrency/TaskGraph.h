@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+class ThreadPool;
+
+/**
+ * Set of named tasks with explicit dependencies between them, executed on a `ThreadPool`.
+ *
+ * Example usage:
+ * ```
+ * TaskGraph graph;
+ * TaskGraph::TaskId lods = graph.add("lods", [] { openLods(); });
+ * graph.add("tables", [] { loadTables(); }, {lods});
+ * graph.add("video", [] { openVideos(); });
+ * graph.run(pool);
+ * ```
+ *
+ * A task is started only after all its dependencies have finished. Tasks are added in topological order - a task
+ * can only depend on tasks that were added before it, so there can be no cycles.
+ */
+class TaskGraph {
+ public:
+    using TaskId = int;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @param name                      Task name, used for reporting.
+     * @param task                      Task to run.
+     * @param dependencies              Tasks that must finish before this one can start.
+     * @return                          Id of the added task.
+     */
+    TaskId add(std::string name, std::function<void()> task, std::initializer_list<TaskId> dependencies = {});
+
+    /**
+     * Runs all the tasks in this graph and blocks until they're done.
+     *
+     * If a task throws, the tasks that depend on it are skipped, all other tasks are still run, and then the first
+     * exception is rethrown on the calling thread.
+     *
+     * @param pool                      Thread pool to run the tasks on.
+     */
+    void run(ThreadPool *pool);
+
+    [[nodiscard]] int size() const {
+        return _tasks.size();
+    }
+
+    [[nodiscard]] const std::string &name(TaskId id) const {
+        return _tasks[id].name;
+    }
+
+    /**
+     * @param id                        Task id.
+     * @return                          Time it took to execute the task during the last call to `run`. Zero for
+     *                                  skipped tasks.
+     */
+    [[nodiscard]] Clock::duration duration(TaskId id) const {
+        return _tasks[id].duration;
+    }
+
+ private:
+    struct Task {
+        std::string name;
+        std::function<void()> function;
+        std::vector<TaskId> dependents;
+        int dependencyCount = 0;
+        Clock::duration duration = {};
+    };
+
+    struct RunState;
+
+    static void schedule(ThreadPool *pool, const std::shared_ptr<RunState> &state, TaskId id);
+
+ private:
+    std::vector<Task> _tasks;
+};
@@ -0,0 +1,59 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Concurrency/TaskGraph.h"
+#include "Utility/Concurrency/ThreadPool.h"
+
+UNIT_TEST(TaskGraph, Dependencies) {
+    for (int threads : {0, 1, 4}) {
+        ThreadPool pool(threads);
+
+        std::atomic<int> counter = 0;
+        std::vector<int> order(5, -1);
+        auto task = [&](int index) {
+            return [&, index] { order[index] = counter++; };
+        };
+
+        TaskGraph graph;
+        TaskGraph::TaskId a = graph.add("a", task(0));
+        TaskGraph::TaskId b = graph.add("b", task(1), {a});
+        TaskGraph::TaskId c = graph.add("c", task(2), {a});
+        graph.add("d", task(3), {b, c});
+        graph.add("e", task(4));
+        graph.run(&pool);
+
+        EXPECT_EQ(counter, 5);
+        EXPECT_LT(order[0], order[1]);
+        EXPECT_LT(order[0], order[2]);
+        EXPECT_LT(order[1], order[3]);
+        EXPECT_LT(order[2], order[3]);
+        EXPECT_GE(order[4], 0);
+    }
+}
+
+UNIT_TEST(TaskGraph, Exception) {
+    ThreadPool pool(2);
+
+    bool dependentRun = false;
+    bool independentRun = false;
+
+    TaskGraph graph;
+    TaskGraph::TaskId a = graph.add("a", [] { throw std::runtime_error("42"); });
+    TaskGraph::TaskId b = graph.add("b", [&] { dependentRun = true; }, {a});
+    graph.add("c", [&] { dependentRun = true; }, {b});
+    graph.add("d", [&] { independentRun = true; });
+
+    EXPECT_THROW(graph.run(&pool), std::runtime_error);
+    EXPECT_FALSE(dependentRun);
+    EXPECT_TRUE(independentRun);
+}
+
+UNIT_TEST(TaskGraph, Empty) {
+    ThreadPool pool(2);
+    TaskGraph graph;
+    graph.run(&pool);
+    EXPECT_EQ(graph.size(), 0);
+}
@@ -0,0 +1,54 @@
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Concurrency/ThreadPool.h"
+
+UNIT_TEST(ThreadPool, Submit) {
+    ThreadPool pool(2);
+    std::future<int> answer = pool.submit([] { return 42; });
+    EXPECT_EQ(answer.get(), 42);
+
+    std::future<void> failure = pool.submit([] { throw std::runtime_error("42"); });
+    EXPECT_THROW(failure.get(), std::runtime_error);
+}
+
+UNIT_TEST(ThreadPool, SubmitNoThreads) {
+    ThreadPool pool(0);
+    std::future<int> answer = pool.submit([] { return 42; });
+    EXPECT_EQ(answer.get(), 42);
+}
+
+UNIT_TEST(ThreadPool, ParallelFor) {
+    for (int threads : {0, 1, 4}) {
+        ThreadPool pool(threads);
+
+        std::vector<int> values(10000, 0);
+        pool.parallelFor(values.size(), [&](size_t i) { values[i] += i; });
+
+        for (size_t i = 0; i < values.size(); i++)
+            EXPECT_EQ(values[i], i);
+    }
+}
+
+UNIT_TEST(ThreadPool, ParallelForNested) {
+    ThreadPool pool(2);
+
+    std::atomic<int> counter = 0;
+    pool.parallelFor(16, [&](size_t) {
+        pool.parallelFor(16, [&](size_t) { counter++; });
+    });
+    EXPECT_EQ(counter, 256);
+}
+
+UNIT_TEST(ThreadPool, ParallelForThrows) {
+    ThreadPool pool(4);
+
+    EXPECT_THROW(pool.parallelFor(1000, [&](size_t i) {
+        if (i == 500)
+            throw std::runtime_error("500");
+    }), std::runtime_error);
+}
@@ -0,0 +1,88 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+ThreadPool::ThreadPool(int threadCount) {
+    _threads.reserve(std::max(threadCount, 0));
+    for (int i = 0; i < threadCount; i++)
+        _threads.emplace_back([this] { workerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::scoped_lock lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+
+    for (std::thread &thread : _threads)
+        thread.join();
+}
+
+int ThreadPool::defaultThreadCount() {
+    return std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1);
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+    if (_threads.empty()) {
+        task();
+        return;
+    }
+
+    {
+        std::scoped_lock lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _condition.notify_one();
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty())
+                return; // Stopping & no more work. Note that we drain the queue before exiting.
+
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::ParallelForState::run() {
+    while (true) {
+        size_t chunk = nextChunk.fetch_add(1);
+        if (chunk >= chunkCount)
+            return;
+
+        size_t begin = chunk * chunkSize;
+        size_t end = std::min(begin + chunkSize, count);
+        try {
+            for (size_t i = begin; i < end; i++)
+                callback(i);
+        } catch (...) {
+            std::scoped_lock lock(mutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+
+        if (doneChunks.fetch_add(1) + 1 == chunkCount) {
+            std::scoped_lock lock(mutex); // Lock so that the notification can't slip in between the check & the wait.
+            condition.notify_all();
+        }
+    }
+}
+
+void ThreadPool::ParallelForState::wait() {
+    {
+        std::unique_lock lock(mutex);
+        condition.wait(lock, [this] { return doneChunks.load() == chunkCount; });
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
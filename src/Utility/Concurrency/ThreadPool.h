@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Simple fixed-size thread pool with a single shared task queue.
+ *
+ * Example usage:
+ * ```
+ * ThreadPool pool;
+ * std::future<int> answer = pool.submit([] { return 42; });
+ * pool.parallelFor(values.size(), [&](size_t i) { values[i] = compute(i); });
+ * ```
+ *
+ * Tasks must not block waiting on other tasks submitted to the same pool, with the exception of `parallelFor`, which
+ * is safe to call from inside a task because the calling thread processes the work itself if all workers are busy.
+ */
+class ThreadPool {
+ public:
+    /**
+     * @param threadCount               Number of worker threads. Zero is allowed, in this case `submit` runs tasks
+     *                                  synchronously, and `parallelFor` does all the work on the calling thread.
+     */
+    explicit ThreadPool(int threadCount = defaultThreadCount());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @return                          Number of hardware threads minus one for the main thread, but at least one.
+     */
+    [[nodiscard]] static int defaultThreadCount();
+
+    [[nodiscard]] int threadCount() const {
+        return _threads.size();
+    }
+
+    /**
+     * @param callable                  Callable to run on a worker thread.
+     * @return                          Future for the callable's result. Exceptions thrown by the callable are
+     *                                  propagated through the future.
+     */
+    template<class Callable>
+    [[nodiscard]] std::future<std::invoke_result_t<Callable>> submit(Callable &&callable) {
+        using Result = std::invoke_result_t<Callable>;
+
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Callable>(callable));
+        std::future<Result> result = task->get_future();
+        enqueue([task] { (*task)(); });
+        return result;
+    }
+
+    /**
+     * Calls `callback(i)` for every `i` in `[0, count)`, distributing the calls between the worker threads and the
+     * calling thread, and blocks until all calls are done. The order of the calls is unspecified, so the callback
+     * should only write to the state associated with its index.
+     *
+     * If any of the calls throws, the remaining chunks are still processed, and then the first exception is rethrown
+     * on the calling thread.
+     *
+     * @param count                     Number of indices to process.
+     * @param callback                  Callback to invoke, takes a single `size_t` argument.
+     * @param minChunkSize              Minimal number of consecutive indices to process in a single chunk. Use this
+     *                                  to amortize the scheduling overhead for cheap callbacks.
+     */
+    template<class Callback>
+    void parallelFor(size_t count, Callback &&callback, size_t minChunkSize = 1) {
+        if (count == 0)
+            return;
+
+        size_t chunkSize = std::max<size_t>(minChunkSize, (count + 4 * (threadCount() + 1) - 1) / (4 * (threadCount() + 1)));
+        size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+        if (chunkCount == 1 || threadCount() == 0) {
+            for (size_t i = 0; i < count; i++)
+                callback(i);
+            return;
+        }
+
+        auto state = std::make_shared<ParallelForState>();
+        state->count = count;
+        state->chunkSize = chunkSize;
+        state->chunkCount = chunkCount;
+        state->callback = [&callback](size_t i) { callback(i); };
+
+        size_t helperCount = std::min<size_t>(threadCount(), chunkCount - 1);
+        for (size_t i = 0; i < helperCount; i++)
+            enqueue([state] { state->run(); });
+
+        state->run();
+        state->wait();
+    }
+
+ private:
+    struct ParallelForState {
+        size_t count = 0;
+        size_t chunkSize = 0;
+        size_t chunkCount = 0;
+        std::function<void(size_t)> callback; // Only accessed while processing a chunk, so it's OK to capture by ref.
+        std::atomic<size_t> nextChunk = 0;
+        std::atomic<size_t> doneChunks = 0;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::exception_ptr exception;
+
+        void run();
+        void wait();
+    };
+
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+
+ private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<std::function<void()>> _tasks;
+    std::vector<std::thread> _threads;
+    bool _stopping = false;
+};
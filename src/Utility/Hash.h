@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <functional> // For std::hash.
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace detail {
@@ -50,3 +53,33 @@ struct std::hash<std::pair<A, B>> {
         return seed;
     }
 };
+
+/**
+ * 64-bit FNV-1a hasher. Unlike `std::hash`, results are stable across platforms & runs, so this can be used for
+ * on-disk cache keys.
+ */
+class Fnv1aHasher {
+ public:
+    void add(const void *data, size_t size) {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < size; i++)
+            _hash = (_hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+
+    template<class T> requires std::is_arithmetic_v<T>
+    void add(T value) {
+        add(&value, sizeof(value));
+    }
+
+    void add(std::string_view value) {
+        add(value.size());
+        add(value.data(), value.size());
+    }
+
+    [[nodiscard]] uint64_t hash() const {
+        return _hash;
+    }
+
+ private:
+    uint64_t _hash = 0xCBF29CE484222325ull;
+};
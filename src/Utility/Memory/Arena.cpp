@@ -0,0 +1,59 @@
+#include "Arena.h"
+
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+
+Arena::Arena(size_t pageSize) : _pageSize(pageSize) {
+    assert(pageSize > 0);
+}
+
+Arena::~Arena() = default;
+
+void *Arena::allocate(size_t size, size_t alignment) {
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    if (!_pages.empty()) {
+        const Page &page = _pages.back();
+        uintptr_t base = reinterpret_cast<uintptr_t>(page.data.get());
+        size_t offset = ((base + _pageUsed + alignment - 1) & ~(alignment - 1)) - base;
+        if (offset + size <= page.size) {
+            _pageUsed = offset + size;
+            return page.data.get() + offset;
+        }
+    }
+
+    // Memory returned by new[] is aligned to at least alignof(std::max_align_t), so we only need to pad for larger
+    // alignments.
+    size_t padding = alignment > alignof(std::max_align_t) ? alignment : 0;
+    Page page;
+    page.size = std::max(_pageSize, size + padding);
+    page.data.reset(new std::byte[page.size]);
+    _reservedBytes += page.size;
+    _pages.push_back(std::move(page));
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(_pages.back().data.get());
+    size_t offset = ((base + alignment - 1) & ~(alignment - 1)) - base;
+    _pageUsed = offset + size;
+    return _pages.back().data.get() + offset;
+}
+
+Arena::Marker Arena::mark() const {
+    return {_pages.size(), _pageUsed};
+}
+
+void Arena::rewind(Marker marker) {
+    assert(marker.pageCount <= _pages.size());
+    assert(marker.pageCount < _pages.size() || marker.pageUsed <= _pageUsed);
+
+    while (_pages.size() > marker.pageCount) {
+        _reservedBytes -= _pages.back().size;
+        _pages.pop_back();
+    }
+    _pageUsed = marker.pageUsed;
+}
+
+void Arena::clear() {
+    rewind(Marker());
+}
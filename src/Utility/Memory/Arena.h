@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * Bump allocator that hands out memory from a list of large pages.
+ *
+ * Individual allocations can't be freed. Instead, memory is freed in bulk, either all at once with `clear`, or
+ * stack-style with `mark` & `rewind`:
+ * ```
+ * Arena::Marker marker = arena.mark();
+ * loadLevelStuff(&arena);
+ * ...
+ * arena.rewind(marker); // Frees everything that was allocated after the call to `mark`.
+ * ```
+ *
+ * This class is not thread-safe.
+ */
+class Arena {
+ public:
+    static constexpr size_t DEFAULT_PAGE_SIZE = 1024 * 1024;
+
+    struct Marker {
+        size_t pageCount = 0;
+        size_t pageUsed = 0;
+    };
+
+    /**
+     * @param pageSize                  Size of a single page. Allocations that don't fit into a page get a dedicated
+     *                                  page of their own.
+     */
+    explicit Arena(size_t pageSize = DEFAULT_PAGE_SIZE);
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    /**
+     * @param size                      Number of bytes to allocate.
+     * @param alignment                 Required alignment, must be a power of two.
+     * @return                          Pointer to uninitialized memory, valid until it's freed with `rewind` or
+     *                                  `clear`. Never returns `nullptr`.
+     */
+    [[nodiscard]] void *allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @return                          Marker for the current state of the arena, to be passed to `rewind`.
+     */
+    [[nodiscard]] Marker mark() const;
+
+    /**
+     * Frees all memory that was allocated after the provided marker was taken. Pages that become unused are released
+     * back to the system.
+     *
+     * @param marker                    Marker, as returned by `mark`.
+     */
+    void rewind(Marker marker);
+
+    /**
+     * Frees all memory allocated in this arena.
+     */
+    void clear();
+
+    /**
+     * @return                          Total size of all pages currently allocated by this arena.
+     */
+    [[nodiscard]] size_t reservedBytes() const {
+        return _reservedBytes;
+    }
+
+ private:
+    struct Page {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+ private:
+    size_t _pageSize = 0;
+    size_t _pageUsed = 0; // Number of bytes used in the last page.
+    size_t _reservedBytes = 0;
+    std::vector<Page> _pages;
+};
@@ -0,0 +1,63 @@
+#include <cstdint>
+#include <cstring>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Memory/Arena.h"
+
+UNIT_TEST(Arena, Allocate) {
+    Arena arena(1024);
+
+    char *a = static_cast<char *>(arena.allocate(100));
+    char *b = static_cast<char *>(arena.allocate(100));
+    EXPECT_NE(a, b);
+    EXPECT_GE(b, a + 100); // Same page, no overlap.
+    EXPECT_EQ(arena.reservedBytes(), 1024);
+
+    memset(a, 1, 100);
+    memset(b, 2, 100);
+    EXPECT_EQ(a[99], 1);
+    EXPECT_EQ(b[0], 2);
+
+    // Doesn't fit into the current page.
+    (void) arena.allocate(1000);
+    EXPECT_EQ(arena.reservedBytes(), 2048);
+
+    // Doesn't fit into a page at all.
+    (void) arena.allocate(5000);
+    EXPECT_EQ(arena.reservedBytes(), 2048 + 5000);
+
+    arena.clear();
+    EXPECT_EQ(arena.reservedBytes(), 0);
+}
+
+UNIT_TEST(Arena, Alignment) {
+    Arena arena(1024);
+    for (size_t alignment : {1, 2, 8, 16, 64, 256}) {
+        (void) arena.allocate(1, 1);
+        void *ptr = arena.allocate(10, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0);
+    }
+
+    void *ptr = arena.allocate(2000, 4096);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 4096, 0);
+}
+
+UNIT_TEST(Arena, Rewind) {
+    Arena arena(1024);
+
+    char *a = static_cast<char *>(arena.allocate(100));
+    Arena::Marker marker = arena.mark();
+    char *b = static_cast<char *>(arena.allocate(100));
+    for (int i = 0; i < 10; i++)
+        (void) arena.allocate(1000);
+    EXPECT_EQ(arena.reservedBytes(), 11 * 1024);
+
+    arena.rewind(marker);
+    EXPECT_EQ(arena.reservedBytes(), 1024);
+
+    // Memory after the marker is reused, memory before the marker is not.
+    char *c = static_cast<char *>(arena.allocate(100));
+    EXPECT_EQ(b, c);
+    EXPECT_NE(a, c);
+}
@@ -8,6 +8,7 @@
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
 #include "Engine/Resources/EngineFileSystem.h"
+#include "Engine/SaveLoad.h"
 #include "Engine/Components/Trace/EngineTracePlayer.h"
 #include "Engine/Components/Trace/EngineTraceStateAccessor.h"
 #include "Engine/Components/Control/EngineController.h"
@@ -127,6 +128,8 @@ void TestController::prepareForNextTestInternal() {
     int frameTimeMs = engine->config->debug.TraceFrameTimeMs.value();
     RandomEngineType rngType = engine->config->debug.TraceRandomEngine.value();
 
+    FinishPendingSave(); // Otherwise autosave from the previous test might get written after the cleanup.
+
     for (const DirectoryEntry &entry : ufs->ls(""))
         ufs->remove(entry.name);
 